@@ -0,0 +1,31 @@
+#include "benchmarkFunctions.hpp"
+#include "../runBenchmarks.hpp"
+#include "../src/asyncEngine.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+void runAsyncEngineBenchmarks() {
+
+    std::cout << "ASYNC ENGINE BENCHMARKS (cancel to return latency)" << std::endl;
+
+    constexpr auto SEARCHES{50}; // Number of cancelled searches
+
+    // The searches of the empty board never finish on their own
+    AsyncEngine engine;
+    const Board empty;
+    std::vector<double> latencies;
+    for (int search{0}; search < SEARCHES; search++) {
+        const auto handle{engine.startSearch(empty, SearchLimits{})};
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 + search % 20));
+        handle->cancel();
+        handle->wait();
+        latencies.push_back(handle->getCancelLatency());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto total{0.0};
+    for (const auto latency : latencies) total += latency;
+    std::cout << std::fixed << std::setprecision(3) << "searches " << SEARCHES << ", mean " << total / SEARCHES
+        << " ms, median " << latencies[SEARCHES / 2] << " ms, max " << latencies.back() << " ms" << std::endl;
+}
@@ -0,0 +1,48 @@
+#ifndef BENCHMARKFUNCTIONS_HPP
+#define BENCHMARKFUNCTIONS_HPP
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "../src/board.hpp"
+
+/**
+ * @brief Benchmark positions, given as the sequence of played columns.
+ * Late middlegame positions that take between a few thousand and a few million nodes to solve.
+ */
+static const std::string BENCHMARK_POSITIONS[] {
+    "7211540324713180473658647567338514516",
+    "013358010531154742300822837732522",
+    "250003654733388177665388764760315",
+    "781267288505440844737253226176115",
+    "61715001280406173051401471628",
+    "48700564731007630638330084868",
+    "07303855474655827513218544572"
+};
+
+/**
+ * @brief Play a sequence of columns on a board.
+ * @param board The board to play the moves on.
+ * @param sequence The played columns, one digit per move.
+ */
+inline void playSequence(Board &board, const std::string &sequence) {
+    for (const auto column : sequence) {
+        board.playMove(column - '0');
+    }
+}
+
+/**
+ * @brief Measure the wall time of a function.
+ * @param function The function to measure.
+ * @return The elapsed time in seconds.
+ */
+template <typename F>
+double measureSeconds(F function) {
+    const auto start{std::chrono::steady_clock::now()};
+    function();
+    const auto end{std::chrono::steady_clock::now()};
+    return std::chrono::duration<double>(end - start).count();
+}
+
+#endif
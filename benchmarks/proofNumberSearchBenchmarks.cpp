@@ -0,0 +1,48 @@
+#include "benchmarkFunctions.hpp"
+#include "../runBenchmarks.hpp"
+#include "../src/proofNumberSearch.hpp"
+#include "../src/solver.hpp"
+
+/**
+ * @brief Sharp positions with a forced win (first three) and the benchmark positions that df-pn solves quickly.
+ */
+static const std::string PROOF_NUMBER_POSITIONS[] {
+    "64082075311336703648332277",
+    "20838556400188067235002045",
+    "76163118557561021177316040",
+    "7211540324713180473658647567338514516",
+    "250003654733388177665388764760315",
+    "07303855474655827513218544572"
+};
+
+void runProofNumberSearchBenchmarks() {
+
+    std::cout << "PROOF NUMBER SEARCH BENCHMARKS (df-pn vs weak solve)" << std::endl;
+    std::cout << std::left << std::setw(40) << "position" << std::right
+        << std::setw(7) << "result" << std::setw(14) << "df-pn nodes" << std::setw(11) << "df-pn s"
+        << std::setw(14) << "weak nodes" << std::setw(11) << "weak s" << std::endl;
+
+    for (const auto &position : PROOF_NUMBER_POSITIONS) {
+        Board game;
+        playSequence(game, position);
+
+        // Both searches start from empty tables
+        ProofNumberSearch prover;
+        ProofNumberSearch::Result result;
+        const auto proof_time{measureSeconds([&]() {result = prover.search(game, 10000000ULL);})};
+
+        Solver solver;
+        int weak_result;
+        const auto weak_time{measureSeconds([&]() {weak_result = solver.solveWeak(game);})};
+
+        if ((result == ProofNumberSearch::PROVEN) != (weak_result > 0)) {
+            std::cout << "Result mismatch in " << position << ": " << result << " for the outcome " << weak_result
+                << std::endl;
+        }
+
+        std::cout << std::left << std::setw(40) << position << std::right << std::fixed << std::setprecision(3)
+            << std::setw(7) << (result == ProofNumberSearch::PROVEN ? "win" : "no win")
+            << std::setw(14) << prover.getNodeCount() << std::setw(11) << proof_time
+            << std::setw(14) << solver.getNodeCount() << std::setw(11) << weak_time << std::endl;
+    }
+}
@@ -0,0 +1,142 @@
+#include "benchmarkFunctions.hpp"
+#include "../runBenchmarks.hpp"
+#include "../src/solver.hpp"
+
+/**
+ * @brief Positions with several moves that take some search, for the multi-PV benchmark.
+ */
+static const std::string MULTI_PV_POSITIONS[] {
+    "72115403247131804736586475673385145",
+    "328622011158737830052856561751880063"
+};
+
+/**
+ * @brief Compare the analysis of every move with one shared transposition table against independent solves.
+ */
+static void runMultiPVBenchmarks() {
+    std::cout << "MULTI-PV BENCHMARKS (shared table vs independent solves)" << std::endl;
+    std::cout << std::left << std::setw(40) << "position" << std::right
+        << std::setw(7) << "moves" << std::setw(14) << "shared nodes" << std::setw(11) << "shared s"
+        << std::setw(14) << "indep nodes" << std::setw(11) << "indep s" << std::endl;
+
+    for (const auto &position : MULTI_PV_POSITIONS) {
+        Board game;
+        playSequence(game, position);
+
+        Solver solver;
+        std::vector<Solver::MoveAnalysis> analysis;
+        const auto shared_time{measureSeconds([&]() {analysis = solver.analyze(game);})};
+        const auto shared_nodes{solver.getNodeCount()};
+
+        // Every move solved with its own empty transposition table
+        uint64_t independent_nodes{0ULL};
+        const auto independent_time{measureSeconds([&]() {
+            for (const auto &move : analysis) {
+                Solver independent;
+                std::vector<int> principal_variation;
+                game.playMove(move.column);
+                if (!game.checkLastPlayerWin()) independent.solve(game, principal_variation);
+                game.undoLastMove();
+                independent_nodes += independent.getNodeCount();
+            }
+        })};
+
+        std::cout << std::left << std::setw(40) << position << std::right << std::fixed << std::setprecision(3)
+            << std::setw(7) << analysis.size() << std::setw(14) << shared_nodes << std::setw(11) << shared_time
+            << std::setw(14) << independent_nodes << std::setw(11) << independent_time << std::endl;
+    }
+}
+
+/**
+ * @brief Compare the weak solve (win, draw or loss) against the strong solve (exact score).
+ */
+static void runWeakSolverBenchmarks() {
+    std::cout << "WEAK SOLVER BENCHMARKS (weak vs strong)" << std::endl;
+    std::cout << std::left << std::setw(40) << "position" << std::right
+        << std::setw(7) << "result" << std::setw(14) << "weak nodes" << std::setw(11) << "weak s"
+        << std::setw(14) << "strong nodes" << std::setw(11) << "strong s" << std::endl;
+
+    Solver solver;
+    uint64_t total_weak_nodes{0ULL}, total_strong_nodes{0ULL};
+    double total_weak_time{0.0}, total_strong_time{0.0};
+
+    for (const auto &position : BENCHMARK_POSITIONS) {
+        Board game;
+        playSequence(game, position);
+
+        // Both searches start from empty transposition tables
+        int weak_result, strong_score;
+        solver.reset();
+        const auto weak_time{measureSeconds([&]() {weak_result = solver.solveWeak(game);})};
+        const auto weak_nodes{solver.getNodeCount()};
+
+        solver.reset();
+        const auto strong_time{measureSeconds([&]() {strong_score = solver.solve(game);})};
+        const auto strong_nodes{solver.getNodeCount()};
+
+        if (weak_result != (strong_score > 0) - (strong_score < 0)) {
+            std::cout << "Result mismatch in " << position << ": " << weak_result << " for the score " << strong_score
+                << std::endl;
+        }
+
+        std::cout << std::left << std::setw(40) << position << std::right << std::fixed << std::setprecision(3)
+            << std::setw(7) << weak_result << std::setw(14) << weak_nodes << std::setw(11) << weak_time
+            << std::setw(14) << strong_nodes << std::setw(11) << strong_time << std::endl;
+
+        total_weak_nodes += weak_nodes;
+        total_strong_nodes += strong_nodes;
+        total_weak_time += weak_time;
+        total_strong_time += strong_time;
+    }
+
+    std::cout << std::left << std::setw(47) << "total" << std::right
+        << std::setw(14) << total_weak_nodes << std::setw(11) << total_weak_time
+        << std::setw(14) << total_strong_nodes << std::setw(11) << total_strong_time << std::endl;
+}
+
+void runSolverBenchmarks() {
+
+    std::cout << "SOLVER BENCHMARKS (null window vs full window)" << std::endl;
+    std::cout << std::left << std::setw(40) << "position" << std::right
+        << std::setw(7) << "score" << std::setw(14) << "null nodes" << std::setw(11) << "null s"
+        << std::setw(14) << "full nodes" << std::setw(11) << "full s" << std::endl;
+
+    Solver solver;
+    uint64_t total_null_nodes{0ULL}, total_full_nodes{0ULL};
+    double total_null_time{0.0}, total_full_time{0.0};
+
+    for (const auto &position : BENCHMARK_POSITIONS) {
+        Board game;
+        playSequence(game, position);
+
+        // Both searches start from an empty transposition table
+        int null_score, full_score;
+        solver.reset();
+        const auto null_time{measureSeconds([&]() {null_score = solver.solve(game);})};
+        const auto null_nodes{solver.getNodeCount()};
+
+        solver.reset();
+        const auto full_time{measureSeconds([&]() {full_score = solver.solveFullWindow(game);})};
+        const auto full_nodes{solver.getNodeCount()};
+
+        if (null_score != full_score) {
+            std::cout << "Score mismatch in " << position << ": " << null_score << " != " << full_score << std::endl;
+        }
+
+        std::cout << std::left << std::setw(40) << position << std::right << std::fixed << std::setprecision(3)
+            << std::setw(7) << null_score << std::setw(14) << null_nodes << std::setw(11) << null_time
+            << std::setw(14) << full_nodes << std::setw(11) << full_time << std::endl;
+
+        total_null_nodes += null_nodes;
+        total_full_nodes += full_nodes;
+        total_null_time += null_time;
+        total_full_time += full_time;
+    }
+
+    std::cout << std::left << std::setw(47) << "total" << std::right
+        << std::setw(14) << total_null_nodes << std::setw(11) << total_null_time
+        << std::setw(14) << total_full_nodes << std::setw(11) << total_full_time << std::endl;
+
+    runWeakSolverBenchmarks();
+    runMultiPVBenchmarks();
+}
@@ -0,0 +1,104 @@
+#include "src/engine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto FIRST_TURN_MS{1000}; // Time limit of the first turn
+constexpr auto TURN_MS{100}; // Time limit of the other turns
+constexpr auto MARGIN_MS{10}; // Time kept to unwind the search and write the answer
+constexpr uint32_t TABLE_SIZE{8388593U}; // Largest prime below 2^23 (64 MiB of entries)
+
+/**
+ * @brief Get the milliseconds elapsed since a time.
+ * @param start The start time.
+ * @return The elapsed milliseconds.
+ */
+static double elapsedMilliseconds(const Clock::time_point &start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Get the name of the way a move was chosen.
+ * @param source The way the move was chosen.
+ * @return The name of the source.
+ */
+static const char *getSourceName(const Engine::MoveSource &source) {
+    switch (source) {
+        case Engine::WINNING: return "winning";
+        case Engine::FORCED: return "forced";
+        case Engine::BOOK: return "book";
+        case Engine::SOLVED: return "solved";
+        case Engine::PROVEN: return "proven";
+        default: return "heuristic";
+    }
+}
+
+/**
+ * @brief Bot for the Codingame Connect 4 referee.
+ * The referee writes the ids of the players once, then for every turn the turn index, the 7 rows of the grid, the
+ * valid actions and the previous action of the opponent (-1 for none, -2 for a steal). The bot answers with a column
+ * or -2 to steal the first piece. The engine (transposition table and book) is created before reading any input and
+ * is kept for the whole match; its creation counts against the time of the first turn.
+ * Usage: CONNECT4 [book file]
+ */
+int main(int argc, char *argv[]) {
+    const auto start{Clock::now()};
+
+    Engine engine{TABLE_SIZE};
+    const auto book_loaded{argc > 1 && engine.loadBook(argv[1])};
+    std::cerr << "Initialization: " << elapsedMilliseconds(start) << " ms (table of " << TABLE_SIZE << " entries, "
+        << (book_loaded ? std::to_string(engine.getBookSize()) + " book positions" : std::string{"no book"}) << ")" << std::endl;
+
+    int my_id, opp_id;
+    if (!(std::cin >> my_id >> opp_id)) return 0;
+    const char player = '0' + my_id;
+
+    auto first_turn{true};
+    int turn_index;
+    while (std::cin >> turn_index) {
+        // The first turn includes the initialization
+        const auto turn_start{first_turn ? start : Clock::now()};
+        const auto deadline{turn_start + std::chrono::milliseconds((first_turn ? FIRST_TURN_MS : TURN_MS) - MARGIN_MS)};
+
+        std::vector<std::string> rows(7);
+        for (auto &row : rows) std::cin >> row;
+        int actions_num;
+        std::cin >> actions_num;
+        std::vector<int> actions(actions_num);
+        for (auto &action : actions) std::cin >> action;
+        int opp_previous_action;
+        std::cin >> opp_previous_action;
+
+        // Update the position with the move of the opponent, and check it against the grid of the referee
+        if (opp_previous_action == Engine::STEAL) engine.steal();
+        else if (opp_previous_action >= 0) engine.playMove(opp_previous_action);
+
+        Board grid;
+        if (Engine::parseGrid(rows, player, grid) && grid.getBoardKey() != engine.getBoard().getBoardKey()) {
+            std::cerr << "Turn " << turn_index << ": the position does not match the grid, using the grid" << std::endl;
+            engine.setBoard(grid);
+        }
+
+        auto action{Engine::STEAL};
+        if (engine.shouldSteal() && std::find(actions.begin(), actions.end(), Engine::STEAL) != actions.end()) {
+            engine.steal();
+            std::cerr << "Turn " << turn_index << ": steal" << std::endl;
+        } else {
+            const auto move{engine.chooseMove(deadline)};
+            action = move.column;
+            if (std::find(actions.begin(), actions.end(), action) == actions.end()) action = actions.front();
+            engine.playMove(action);
+            std::cerr << "Turn " << turn_index << ": column " << action << " (" << getSourceName(move.source) << ", score "
+                << move.score << ", " << move.nodes << " nodes, " << elapsedMilliseconds(turn_start) << " ms)" << std::endl;
+        }
+
+        std::cout << action << std::endl;
+        first_turn = false;
+    }
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+#include "runBenchmarks.hpp"
+#include <iostream>
+
+int main() {
+
+    runSolverBenchmarks();
+    runAsyncEngineBenchmarks();
+    runProofNumberSearchBenchmarks();
+
+    return 0;
+}
@@ -0,0 +1,8 @@
+#ifndef RUNBENCHMARKS_HPP
+#define RUNBENCHMARKS_HPP
+
+void runSolverBenchmarks();
+void runAsyncEngineBenchmarks();
+void runProofNumberSearchBenchmarks();
+
+#endif
@@ -5,6 +5,18 @@ int main() {
 
     runBoardTests();
     runHashMapTests();
+    runSolverTests();
+    runEndgameDatabaseTests();
+    runArenaTests();
+    runMoveListTests();
+    runGameRecordTests();
+    runPositionArrayTests();
+    runEngineTests();
+    runTournamentTests();
+    runAsyncEngineTests();
+    runProofNumberSearchTests();
+    runStateEnumerationTests();
+    runMultiProcessSolverTests();
 
     return 0;
 }
@@ -3,5 +3,19 @@
 
 void runBoardTests();
 void runHashMapTests();
+void runSolverTests();
+void runEndgameDatabaseTests();
+void runArenaTests();
+void runMoveListTests();
+void runGameRecordTests();
+void runPositionArrayTests();
+void runEngineTests();
+void runTournamentTests();
+void runAsyncEngineTests();
+void runProofNumberSearchTests();
+
+void runStateEnumerationTests();
+
+void runMultiProcessSolverTests();
 
 #endif
@@ -0,0 +1,55 @@
+#include "arena.hpp"
+#include "general.hpp"
+#include <stdint.h>
+
+Arena::Arena(const size_t &theCapacity)
+    : block(new char[theCapacity]), capacity(theCapacity), used(0) {};
+
+Arena::~Arena() {
+    delete[] block;
+}
+
+void *Arena::allocate(const size_t &bytes, const size_t &alignment) {
+    #ifdef DEBUG
+    assertLogic(alignment != 0 && (alignment & (alignment - 1)) == 0, "The alignment of an arena allocation must be a power of two.");
+    #endif
+
+    // Move the first free byte forward to the requested alignment
+    const auto address{(uintptr_t)(block + used)};
+    const auto padding{(alignment - address % alignment) % alignment};
+
+    #ifdef DEBUG
+    assertOverflow(used + padding + bytes <= capacity, "The arena is full. Increase its capacity or reset it more often.");
+    #endif
+    if (used + padding + bytes > capacity) return nullptr;
+
+    used += padding;
+    void *memory = block + used;
+    used += bytes;
+    return memory;
+}
+
+void Arena::reset() {
+    used = 0;
+}
+
+void Arena::resetTo(const size_t &mark) {
+    #ifdef DEBUG
+    assertLogic(mark <= used, "An arena can only be reset to a mark below its used bytes.");
+    #endif
+
+    used = mark;
+}
+
+size_t Arena::getUsed() const {
+    return used;
+}
+
+size_t Arena::getCapacity() const {
+    return capacity;
+}
+
+Arena &Arena::getThreadArena() {
+    thread_local Arena arena;
+    return arena;
+}
@@ -0,0 +1,115 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <stddef.h>
+
+/**
+ * @class Arena
+ * A bump allocator over a single memory block, used for the scratch memory of the searches.
+ * The block is allocated once, when the arena is created, and every allocation just moves a pointer forward, so the
+ * search never touches the heap. Nothing is freed individually: the whole arena is reset at once, usually at the end
+ * of a search through an `ArenaScope`. Every thread has its own arena (`getThreadArena`), so no locking is needed.
+ */
+class Arena {
+private:
+    char *block; // The memory block
+    size_t capacity; // Size of the memory block in bytes
+    size_t used; // Number of bytes already allocated
+
+public:
+    /**
+     * @brief Constructor.
+     * Initializes a new instance of the Arena class.
+     * @param theCapacity The size of the memory block in bytes. Default value is 1 MiB.
+     */
+    Arena(const size_t &theCapacity = 1ULL << 20);
+
+    Arena(const Arena &other) = delete;
+    Arena &operator=(const Arena &other) = delete;
+
+    /**
+     * @brief Destructor for the Arena class.
+     */
+    ~Arena();
+
+    /**
+     * @brief Allocate memory from the arena.
+     * @param bytes The number of bytes to allocate.
+     * @param alignment The alignment of the memory, a power of two. Default value is the alignment of any scalar type.
+     * @return A pointer to the allocated memory, or null if the arena is full.
+     */
+    void *allocate(const size_t &bytes, const size_t &alignment = alignof(max_align_t));
+
+    /**
+     * @brief Allocate an uninitialized array from the arena.
+     * @param count The number of elements of the array.
+     * @return A pointer to the first element of the array, or null if the arena is full.
+     */
+    template <typename T>
+    T *allocateArray(const size_t &count) {
+        return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief Free all the memory allocated from the arena.
+     */
+    void reset();
+
+    /**
+     * @brief Free the memory allocated after a given mark.
+     * @param mark The number of used bytes to go back to, as returned by `getUsed`.
+     */
+    void resetTo(const size_t &mark);
+
+    /**
+     * @brief Get the number of bytes already allocated.
+     * @return The number of used bytes.
+     */
+    size_t getUsed() const;
+
+    /**
+     * @brief Get the size of the memory block.
+     * @return The capacity of the arena in bytes.
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Get the arena of the calling thread.
+     * The arena is created the first time a thread calls this function.
+     * @return The arena of the calling thread.
+     */
+    static Arena &getThreadArena();
+
+};
+
+/**
+ * @class ArenaScope
+ * Frees, when it goes out of scope, all the memory allocated from an arena since the scope was created.
+ * A search creates one at its start, so it leaves the arena as it found it.
+ */
+class ArenaScope {
+private:
+    Arena &arena; // The arena of the scope
+    size_t mark; // Number of used bytes of the arena when the scope was created
+
+public:
+    /**
+     * @brief Constructor.
+     * @param theArena The arena of the scope.
+     */
+    ArenaScope(Arena &theArena)
+        : arena(theArena), mark(theArena.getUsed()) {};
+
+    ArenaScope(const ArenaScope &other) = delete;
+    ArenaScope &operator=(const ArenaScope &other) = delete;
+
+    /**
+     * @brief Destructor. Frees the memory allocated during the scope.
+     */
+    ~ArenaScope() {
+        arena.resetTo(mark);
+    }
+
+};
+
+#endif
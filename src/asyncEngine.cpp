@@ -0,0 +1,100 @@
+#include "asyncEngine.hpp"
+
+SearchHandle::SearchHandle()
+    : best_move{-1, Engine::HEURISTIC, 0, 0ULL, 0}, finished(false), cancelled(false) {};
+
+void SearchHandle::update(const Engine::Move &move) {
+    std::lock_guard<std::mutex> lock{mutex};
+    best_move = move;
+}
+
+void SearchHandle::finish(const Engine::Move &move) {
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        best_move = move;
+        finished = true;
+        finish_time = std::chrono::steady_clock::now();
+    }
+    finished_condition.notify_all();
+}
+
+bool SearchHandle::poll() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return finished;
+}
+
+Engine::Move SearchHandle::wait() {
+    std::unique_lock<std::mutex> lock{mutex};
+    finished_condition.wait(lock, [this]() {return finished;});
+    return best_move;
+}
+
+bool SearchHandle::waitFor(const std::chrono::milliseconds &timeout) {
+    std::unique_lock<std::mutex> lock{mutex};
+    return finished_condition.wait_for(lock, timeout, [this]() {return finished;});
+}
+
+void SearchHandle::cancel() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (cancelled || finished) return;
+    cancel_time = std::chrono::steady_clock::now();
+    cancelled = true;
+}
+
+Engine::Move SearchHandle::getBestMove() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return best_move;
+}
+
+double SearchHandle::getCancelLatency() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!cancelled || !finished) return -1.0;
+    return std::chrono::duration<double, std::milli>(finish_time - cancel_time).count();
+}
+
+AsyncEngine::AsyncEngine(const uint32_t &theTableSize)
+    : engine(theTableSize) {};
+
+AsyncEngine::~AsyncEngine() {
+    stopSearch();
+}
+
+void AsyncEngine::stopSearch() {
+    if (current) current->cancel();
+    if (worker.joinable()) worker.join();
+    current.reset();
+}
+
+bool AsyncEngine::loadBook(const std::string &path) {
+    stopSearch();
+    return engine.loadBook(path);
+}
+
+std::shared_ptr<SearchHandle> AsyncEngine::startSearch(const Board &position, const SearchLimits &limits,
+    const Engine::ProgressCallback &progress) {
+    stopSearch();
+
+    current = std::make_shared<SearchHandle>();
+    if (position.checkLastPlayerWin() || position.checkFinishDraw()) {
+        current->finish(current->getBestMove());
+        return current;
+    }
+
+    const auto start{std::chrono::steady_clock::now()};
+    const auto deadline{limits.move_time_ms > 0 ? start + std::chrono::milliseconds(limits.move_time_ms) :
+        std::chrono::steady_clock::time_point::max()};
+    engine.setBoard(position);
+    engine.setStopFlag(&current->cancelled);
+
+    // The thread keeps its own reference to the handle, the caller may drop it
+    worker = std::thread([this, handle = current, deadline, progress]() {
+        const auto move{engine.chooseMove(deadline, [&](const Engine::Move &best) {
+            handle->update(best);
+            if (progress) progress(best);
+        })};
+        engine.setStopFlag(nullptr);
+        handle->finish(move);
+    });
+
+    return current;
+}
@@ -0,0 +1,151 @@
+#ifndef ASYNCENGINE_HPP
+#define ASYNCENGINE_HPP
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "engine.hpp"
+
+/**
+ * @brief The limits of a search.
+ */
+struct SearchLimits {
+    int move_time_ms{0}; // Maximum time of the search in milliseconds, 0 for no limit
+};
+
+/**
+ * @class SearchHandle
+ * The state of a search running on the thread of an AsyncEngine, shared with the caller.
+ * The handle can be polled, awaited or cancelled from any thread. A cancelled search returns its best move so far as
+ * soon as the solver checks its stop flag (every 1024 nodes, about a millisecond).
+ */
+class SearchHandle {
+private:
+    friend class AsyncEngine;
+
+    mutable std::mutex mutex; // Lock of the move and the finished flag
+    std::condition_variable finished_condition; // Notified when the search finishes
+    Engine::Move best_move; // The best move so far, or the result once the search finished
+    bool finished; // Whether the search finished
+    std::atomic<bool> cancelled; // Stop flag of the solver
+    std::chrono::steady_clock::time_point cancel_time; // Time of the first cancel request
+    std::chrono::steady_clock::time_point finish_time; // Time at which the search finished
+
+    /**
+     * @brief Update the best move so far.
+     * @param move The best move so far.
+     */
+    void update(const Engine::Move &move);
+
+    /**
+     * @brief Store the result of the search and wake up the waiting threads.
+     * @param move The chosen move.
+     */
+    void finish(const Engine::Move &move);
+
+public:
+    /**
+     * @brief Constructor.
+     * Initializes the handle of a search that has not found any move yet.
+     */
+    SearchHandle();
+
+    SearchHandle(const SearchHandle &other) = delete;
+    SearchHandle &operator=(const SearchHandle &other) = delete;
+
+    /**
+     * @brief Check if the search finished, without blocking.
+     * @return True if the search finished, false otherwise.
+     */
+    bool poll() const;
+
+    /**
+     * @brief Wait for the end of the search.
+     * @return The chosen move.
+     */
+    Engine::Move wait();
+
+    /**
+     * @brief Wait for the end of the search, at most for some time.
+     * @param timeout The maximum waiting time.
+     * @return True if the search finished, false if the time is over.
+     */
+    bool waitFor(const std::chrono::milliseconds &timeout);
+
+    /**
+     * @brief Ask the search to stop. It does not wait for the end of the search.
+     */
+    void cancel();
+
+    /**
+     * @brief Get the best move so far, or the chosen move once the search finished.
+     * @return The best move. Its column is -1 while no move was found.
+     */
+    Engine::Move getBestMove() const;
+
+    /**
+     * @brief Get the time between the first cancel request and the end of the search.
+     * @return The latency in milliseconds, or -1 if the search was not cancelled or did not finish yet.
+     */
+    double getCancelLatency() const;
+
+};
+
+/**
+ * @class AsyncEngine
+ * An Engine that searches on its own thread, so the caller never blocks.
+ * One search runs at a time: starting a search cancels the previous one and waits for its end. The transposition
+ * table is kept between the searches.
+ */
+class AsyncEngine {
+private:
+    Engine engine; // The engine, only used by the search thread while a search runs
+    std::thread worker; // The thread of the current search
+    std::shared_ptr<SearchHandle> current; // The handle of the current search
+
+    /**
+     * @brief Cancel the current search and wait for its end.
+     */
+    void stopSearch();
+
+public:
+    /**
+     * @brief Constructor.
+     * @param theTableSize The size of the transposition table. Default value is (1ULL << 19) - 1ULL.
+     */
+    AsyncEngine(const uint32_t &theTableSize = (1ULL << 19) - 1ULL);
+
+    AsyncEngine(const AsyncEngine &other) = delete;
+    AsyncEngine &operator=(const AsyncEngine &other) = delete;
+
+    /**
+     * @brief Destructor for the AsyncEngine class. Cancels the current search and waits for its end.
+     */
+    ~AsyncEngine();
+
+    /**
+     * @brief Map an opening book. Cancels the current search.
+     * @param path The path of the book.
+     * @return True if the book was mapped, false otherwise.
+     */
+    bool loadBook(const std::string &path);
+
+    /**
+     * @brief Start the search of the best move of a position.
+     * If the game is already over, the returned handle is finished with the column -1.
+     * @param position The position to search. It is copied.
+     * @param limits The limits of the search.
+     * @param progress Function called on the search thread with the best move so far. Can be empty.
+     * @return The handle of the search.
+     */
+    std::shared_ptr<SearchHandle> startSearch(const Board &position, const SearchLimits &limits,
+        const Engine::ProgressCallback &progress = Engine::ProgressCallback());
+
+};
+
+#endif
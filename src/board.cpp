@@ -1,30 +1,85 @@
 #include "board.hpp"
 #include "general.hpp"
+#include <algorithm>
 
 constexpr auto ROWS_NUM{8}; // Number of rows (including the additional position)
 constexpr auto COLS_NUM{9}; // Number of columns
 
+/**
+ * @brief The random keys of the Zobrist hash, one for every column, row and player (first or second to move).
+ */
+struct ZobristTable {
+    uint64_t keys[2][COLS_NUM][ROWS_NUM - 1]{};
+};
+
+/**
+ * @brief Generate the random keys of the Zobrist hash at compile time (splitmix64).
+ * @return The table of keys.
+ */
+static constexpr ZobristTable generateZobristTable() {
+    ZobristTable table{};
+    uint64_t state{0x9E3779B97F4A7C15ULL};
+    for (auto &player_keys : table.keys) {
+        for (auto &column_keys : player_keys) {
+            for (auto &key : column_keys) {
+                state += 0x9E3779B97F4A7C15ULL;
+                auto mixed{state};
+                mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+                key = mixed ^ (mixed >> 31);
+            }
+        }
+    }
+    return table;
+}
+
+static constexpr ZobristTable ZOBRIST{generateZobristTable()};
+
 Board::Board(const bool &thePlayer)
-        : current_player(thePlayer), current_play(&play_history[0]) {};
+        : current_player(thePlayer), current_play(&play_history[0]), heights{}, hash(0ULL), mirrored_hash(0ULL) {};
 
-#ifdef DEBUG
 Board::Board(
     const uint128_t &theBoard, const uint128_t &thePlayerPieces, const bool theCurrentPlayer,
     const int *thePlayHistory, const int theActualPlay
 ) : board(theBoard), player_pieces(thePlayerPieces), current_player(theCurrentPlayer), 
     current_play(&play_history[theActualPlay]) {
-    // Copy the play history to the current play
-    std::copy(thePlayHistory, thePlayHistory + theActualPlay, play_history);
+    #ifdef DEBUG
+    assertOverflow(0 <= theActualPlay && theActualPlay <= ROWS_NUM * COLS_NUM - COLS_NUM,
+        "Invalid number of plays. It must be between 0 and the number of cells of the board.");
+    #endif
+
+    if (thePlayHistory != nullptr) {
+        // Copy the play history to the current play
+        std::copy(thePlayHistory, thePlayHistory + theActualPlay, play_history);
+    } else {
+        // Mark the plays as unknown
+        std::fill(play_history, play_history + theActualPlay, -1);
+    }
+    computeHash();
 };
 
 Board::Board(const Board &other)
     : board(other.board), player_pieces(other.player_pieces), 
     current_player(other.current_player), 
-    current_play(play_history + (other.current_play - other.play_history)) {
+    current_play(play_history + (other.current_play - other.play_history)), 
+    hash(other.hash), mirrored_hash(other.mirrored_hash) {
+    std::copy(other.heights, other.heights + COLS_NUM, heights);
     // Copy the play history to the current play
     std::copy(other.play_history, other.play_history + (other.current_play - other.play_history), play_history);
 };
-#endif
+
+Board &Board::operator=(const Board &other) {
+    board = other.board;
+    player_pieces = other.player_pieces;
+    current_player = other.current_player;
+    current_play = play_history + (other.current_play - other.play_history);
+    hash = other.hash;
+    mirrored_hash = other.mirrored_hash;
+    std::copy(other.heights, other.heights + COLS_NUM, heights);
+    // Copy the play history to the current play
+    std::copy(other.play_history, other.play_history + (other.current_play - other.play_history), play_history);
+    return *this;
+}
 
 uint128_t Board::getBoard() const {
     return board;
@@ -61,6 +116,12 @@ void Board::playMove(const int &column) {
     assertError(isValidPosition(column) == true, "Invalid column selection. The chosen column does not belong to the valid positions.");
     #endif
 
+    // Add the piece of the current player to both hashes, its color is given by the parity of the plays
+    const auto row{heights[column]++};
+    const auto color{getNumberOfPlays() & 1};
+    hash ^= ZOBRIST.keys[color][column][row];
+    mirrored_hash ^= ZOBRIST.keys[color][COLS_NUM - 1 - column][row];
+
     // Toggle the player's pieces
     player_pieces ^= board;
 
@@ -86,16 +147,22 @@ void Board::undoLastMove() {
     // Decrement the current play pointer
     current_play--;
 
-    // Start at the top row of the specified column
-    auto row = ROWS_NUM - 1;
+    #ifdef DEBUG
+    // Check if the column of the move is known (boards rebuilt without history do not know it)
+    assertError(*current_play >= 0, "Unable to undo move because the play history of the board is unknown.");
+    #endif
+
+    // The highest occupied row of the column holds the last piece
+    const auto column{*current_play};
+    const auto row{--heights[column]};
 
-    // Find the highest occupied row in the specified column
-    while (((board >> (ROWS_NUM * (*current_play) + row)) & 1ULL) == 0ULL) {
-        row--;
-    }
+    // Remove the piece from both hashes
+    const auto color{getNumberOfPlays() & 1};
+    hash ^= ZOBRIST.keys[color][column][row];
+    mirrored_hash ^= ZOBRIST.keys[color][COLS_NUM - 1 - column][row];
 
     // Remove the piece from the specified column and row
-    board ^= (uint128_t)1ULL << (ROWS_NUM * (*current_play) + row);
+    board ^= (uint128_t)1ULL << (ROWS_NUM * column + row);
 
     // Toggle the player's pieces
     player_pieces ^= board;
@@ -166,6 +233,119 @@ int Board::getWinningPositions() {
     return mask; 
 };
 
+uint128_t Board::getPossibleCells() const {
+    static const uint128_t BOTTOMLINE{1ULL, 72340172838076673ULL};
+    static const uint128_t FULLBOARD{127ULL, 9187201950435737471ULL};
+    // Adding the bottom line moves the lowest empty cell of every column up, the mask discards the full columns
+    return (board + BOTTOMLINE) & FULLBOARD;
+}
+
+uint128_t Board::computeWinningCells(const uint128_t &pieces, const uint128_t &theBoard) const {
+    static const uint128_t FULLBOARD{127ULL, 9187201950435737471ULL};
+    uint128_t winning_cells; // Empty cells that would complete a line of four
+    uint128_t checker; // Variable used for checking pairs of aligned pieces
+
+    // Vertical check
+    winning_cells = (pieces << 1) & (pieces << 2) & (pieces << 3);
+
+    // Horizontal, diagonal (\) and diagonal (/) checks
+    for (const auto shift : {ROWS_NUM, ROWS_NUM - 1, ROWS_NUM + 1}) {
+        checker = (pieces << shift) & (pieces << (2 * shift));
+        winning_cells |= checker & (pieces << (3 * shift));
+        winning_cells |= checker & (pieces >> shift);
+        checker = (pieces >> shift) & (pieces >> (2 * shift));
+        winning_cells |= checker & (pieces << shift);
+        winning_cells |= checker & (pieces >> (3 * shift));
+    }
+
+    // Keep only the empty cells inside the board
+    return winning_cells & (FULLBOARD ^ theBoard);
+}
+
+/**
+ * @brief Convert a bitmask of cells into a bitmask of the columns that contain them.
+ * @param cells The bitmask of cells.
+ * @return The bitmask of columns.
+ */
+static int cellsToColumns(const uint128_t &cells) {
+    static const auto FULLCOLUMN{255ULL};
+    auto mask{0};
+    for (int column{0}; column < COLS_NUM; column++) { // Iterate over each column
+        if (((uint64_t)(cells >> (column * ROWS_NUM)) & FULLCOLUMN) != 0ULL) {
+            mask |= 1 << column; // Set the corresponding bit in the mask
+        }
+    }
+    return mask;
+}
+
+bool Board::canWinNext() const {
+    return (computeWinningCells(player_pieces, board) & getPossibleCells()) != uint128_t{0ULL, 0ULL};
+}
+
+int Board::getNonLosingPositions() const {
+    #ifdef DEBUG
+    assertLogic(!canWinNext(), "The non-losing positions are only defined when the current player cannot win with the next move.");
+    #endif
+
+    auto possible_cells{getPossibleCells()};
+    const auto opponent_winning_cells{computeWinningCells(getOpponentPieces(), board)};
+    const auto forced_cells{possible_cells & opponent_winning_cells};
+
+    if (forced_cells != uint128_t{0ULL, 0ULL}) {
+        // The opponent has more than one winning position, the game is lost
+        if ((forced_cells & (forced_cells - uint128_t{0ULL, 1ULL})) != uint128_t{0ULL, 0ULL}) return 0;
+        // The opponent has exactly one winning position, that column must be played
+        possible_cells = forced_cells;
+    }
+
+    // Avoid playing directly below a winning cell of the opponent
+    return cellsToColumns(possible_cells & ~(opponent_winning_cells >> 1));
+}
+
+int Board::getMoveScore(const int &column) const {
+    #ifdef DEBUG
+    assertError(isValidPosition(column) == true, "Invalid column selection. The chosen column does not belong to the valid positions.");
+    #endif
+    static const auto FULLCOLUMN{255ULL};
+
+    const auto move{getPossibleCells() & ((uint128_t)FULLCOLUMN << (ROWS_NUM * column))};
+    const auto winning_cells{computeWinningCells(player_pieces | move, board | move)};
+
+    return __builtin_popcountll((uint64_t)winning_cells) + __builtin_popcountll((uint64_t)(winning_cells >> 64));
+}
+
+void Board::computeHash() {
+    static const auto FULLCOLUMN{255ULL};
+    const auto plays{getNumberOfPlays()};
+    hash = 0ULL;
+    mirrored_hash = 0ULL;
+
+    for (int column{0}; column < COLS_NUM; column++) { // Iterate over each column
+        const auto cells{(uint64_t)(board >> (column * ROWS_NUM)) & FULLCOLUMN};
+        const auto pieces{(uint64_t)(player_pieces >> (column * ROWS_NUM)) & FULLCOLUMN};
+        heights[column] = __builtin_popcountll(cells);
+
+        for (int row{0}; row < heights[column]; row++) { // Iterate over the pieces of the column
+            // The player to move plays the next piece, the opponent played the last one
+            const auto color{((pieces >> row) & 1ULL) != 0ULL ? plays & 1 : (plays + 1) & 1};
+            hash ^= ZOBRIST.keys[color][column][row];
+            mirrored_hash ^= ZOBRIST.keys[color][COLS_NUM - 1 - column][row];
+        }
+    }
+}
+
+uint64_t Board::getHash() const {
+    return hash;
+}
+
+uint64_t Board::getMirroredHash() const {
+    return mirrored_hash;
+}
+
+uint64_t Board::getCanonicalHash() const {
+    return mirrored_hash < hash ? mirrored_hash : hash;
+}
+
 uint128_t Board::getBoardKey() const {
     static const uint128_t BOTTOMLINE{1ULL, 72340172838076673ULL};
     // Return the sum of the 'BOTTOMLINE', 'board' and 'player_pieces' as the board key
@@ -201,6 +381,102 @@ auto Board::calculateSymmetricKey() const {
     return symetric_key;
 }
 
+/**
+ * @brief Write the 72 bits of a bitboard, one byte per column.
+ * @param bits The bitboard.
+ * @param buffer The buffer to write the 9 bytes to.
+ */
+static void writeBitboard(const uint128_t &bits, uint8_t *buffer) {
+    for (int column{0}; column < COLS_NUM; column++) {
+        buffer[column] = (uint8_t)(uint64_t)(bits >> (column * ROWS_NUM));
+    }
+}
+
+/**
+ * @brief Read the 72 bits of a bitboard, one byte per column.
+ * @param buffer The buffer to read the 9 bytes from.
+ * @return The bitboard.
+ */
+static uint128_t readBitboard(const uint8_t *buffer) {
+    uint64_t tail{0ULL};
+    for (int column{0}; column < COLS_NUM - 1; column++) {
+        tail |= (uint64_t)buffer[column] << (column * ROWS_NUM);
+    }
+    return uint128_t{buffer[COLS_NUM - 1], tail};
+}
+
+int Board::serialize(uint8_t *buffer, const bool &withHistory) const {
+    const auto plays{getNumberOfPlays()};
+
+    // The plays of a board built from its bitboards are unknown, only the short form can be written
+    const auto history{withHistory && std::none_of(play_history, play_history + plays, [](const int &column) {
+        return column < 0;
+    })};
+
+    buffer[0] = SERIALIZATION_VERSION;
+    buffer[1] = (current_player ? 1 : 0) | (history ? 2 : 0);
+    buffer[2] = (uint8_t)plays;
+    writeBitboard(board, buffer + 3);
+    writeBitboard(player_pieces, buffer + 3 + COLS_NUM);
+
+    if (!history) return SERIALIZED_SIZE;
+
+    for (int play{0}; play < plays; play++) {
+        buffer[SERIALIZED_SIZE + play] = (uint8_t)play_history[play];
+    }
+    return SERIALIZED_SIZE + plays;
+}
+
+int Board::deserialize(const uint8_t *buffer, const int &size, Board &board) {
+    if (size < SERIALIZED_SIZE || buffer[0] != SERIALIZATION_VERSION || (buffer[1] & ~3) != 0) return 0;
+
+    const bool theCurrentPlayer = buffer[1] & 1;
+    const bool withHistory = buffer[1] & 2;
+    const int plays = buffer[2];
+    if (plays > ROWS_NUM * COLS_NUM - COLS_NUM) return 0;
+    if (withHistory && size < SERIALIZED_SIZE + plays) return 0;
+
+    // Every column must be filled from the bottom and the current player must own half of the pieces
+    int pieces_num{0}, player_pieces_num{0};
+    for (int column{0}; column < COLS_NUM; column++) {
+        const auto column_cells{buffer[3 + column]};
+        const auto column_pieces{buffer[3 + COLS_NUM + column]};
+        if ((column_cells & (column_cells + 1)) != 0 || column_cells >= (1 << (ROWS_NUM - 1))) return 0;
+        if ((column_pieces & ~column_cells) != 0) return 0;
+        pieces_num += __builtin_popcount(column_cells);
+        player_pieces_num += __builtin_popcount(column_pieces);
+    }
+    if (pieces_num != plays || player_pieces_num != plays / 2) return 0;
+
+    const auto theBoard{readBitboard(buffer + 3)};
+    const auto thePlayerPieces{readBitboard(buffer + 3 + COLS_NUM)};
+
+    if (!withHistory) {
+        board = Board{theBoard, thePlayerPieces, theCurrentPlayer, nullptr, plays};
+        return SERIALIZED_SIZE;
+    }
+
+    // The history must lead to the encoded position
+    Board replay{(plays % 2 == 0) == theCurrentPlayer};
+    for (int play{0}; play < plays; play++) {
+        const int column = buffer[SERIALIZED_SIZE + play];
+        if (column >= COLS_NUM || !replay.isValidPosition(column)) return 0;
+        replay.playMove(column);
+    }
+    if (replay.board != theBoard || replay.player_pieces != thePlayerPieces) return 0;
+
+    board = replay;
+    return SERIALIZED_SIZE + plays;
+}
+
+uint128_t Board::getCanonicalKey() const {
+    const auto board_key = getBoardKey();
+    const auto symmetric_key = calculateSymmetricKey();
+
+    // Both mirror images share the smallest key
+    return symmetric_key < board_key ? symmetric_key : board_key;
+}
+
 bool Board::isBoardSymmetrical() const {
     // Get the key of the current board
     const auto board_key = getBoardKey();
@@ -25,6 +25,28 @@ private:
     bool current_player; // The current player (true for player 1, false for player 2)
     int play_history[63]; // Array to store the play history (up to 63 moves)
     int *current_play; // Pointer to the current play in the play history
+    int heights[9]; // Number of pieces in each column
+    uint64_t hash; // Zobrist hash of the pieces, updated with every move
+    uint64_t mirrored_hash; // Zobrist hash of the mirror image of the pieces
+
+    /**
+     * @brief Get a bitmask of the cells that can be played in the next move.
+     * @return The bitmask with one cell set for each column that is not full.
+     */
+    uint128_t getPossibleCells() const;
+
+    /**
+     * @brief Compute the empty cells that would complete a line of four for the given pieces.
+     * @param pieces The pieces of the player to check.
+     * @param theBoard The occupied cells of the board.
+     * @return The bitmask of empty cells that would give the player a win.
+     */
+    uint128_t computeWinningCells(const uint128_t &pieces, const uint128_t &theBoard) const;
+
+    /**
+     * @brief Recompute the heights of the columns and the hashes from the bitboards.
+     */
+    void computeHash();
 
 public:
     /**
@@ -34,15 +56,14 @@ public:
      */
     Board(const bool &thePlayer = true);
 
-    #ifdef DEBUG
     /**
      * @brief Constructor.
-     * Initializes a new instance of the Board class.
-     * Only for debugging purposes.
+     * Initializes a new instance of the Board class from its bitboards.
      * @param theBoard The board state.
      * @param thePlayerPieces The player's pieces.
      * @param theCurrentPlayer The current player.
-     * @param thePlayHistory The play history.
+     * @param thePlayHistory The play history, or null if it is unknown. Without history, the moves before this
+     * position cannot be undone.
      * @param theActualPlay The number of plays in the play history.
      */
     Board(
@@ -56,11 +77,16 @@ public:
     /**
      * @brief Copy constructor.
      * Creates a new instance of the Board class from an existing instance.
-     * Only for debugging purposes.
      * @param other The other Board instance to copy from.
      */
     Board(const Board &other);
-    #endif
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The other Board instance to copy from.
+     * @return A reference to this board.
+     */
+    Board &operator=(const Board &other);
 
     /**
      * @brief Get the game board.
@@ -151,12 +177,56 @@ public:
      */
     int getWinningPositions();
 
+    /**
+     * @brief Check if the current player can win with the next move.
+     * Unlike `getWinningPositions`, this function works directly on the bitboards and does not play any move.
+     * @return True if the current player has a winning move, false otherwise.
+     */
+    bool canWinNext() const;
+
+    /**
+     * @brief Get a bitmask of the positions that do not give the opponent an immediate win.
+     * If the opponent has more than one winning position the current player cannot stop them and the mask is empty.
+     * Only meaningful when the current player cannot win with the next move.
+     * @return The bitmask of non-losing positions on the board.
+     */
+    int getNonLosingPositions() const;
+
+    /**
+     * @brief Get a heuristic score of a move, used to order the moves during the search.
+     * @param column The column of the move.
+     * @return The number of winning cells the current player would have after playing the move.
+     */
+    int getMoveScore(const int &column) const;
+
     /**
      * @brief Get a unique key for the current state of the game board.
      * @return The unique key for the current game board state.
      */
     uint128_t getBoardKey() const;
 
+    /**
+     * @brief Get the Zobrist hash of the current state of the game board.
+     * The hash is the XOR of a random key for every piece, chosen by its column, its row and whether it was played
+     * by the first or the second player to move, so it is updated with a single XOR by every move. Two boards with the
+     * same key have the same hash. Different boards can share it, with a probability of about 2^-64.
+     * @return The 64-bit hash of the game board.
+     */
+    uint64_t getHash() const;
+
+    /**
+     * @brief Get the Zobrist hash of the mirror image of the game board.
+     * It is updated alongside the hash, so it equals the hash of the board with the columns in reverse order.
+     * @return The 64-bit hash of the mirror image of the game board.
+     */
+    uint64_t getMirroredHash() const;
+
+    /**
+     * @brief Get a hash that is shared by the current board state and its mirror image.
+     * @return The smallest of the hash and the mirrored hash.
+     */
+    uint64_t getCanonicalHash() const;
+
     /**
      * @brief Retrieves the column at the specified index.
      * @param column The index of the column to retrieve.
@@ -172,6 +242,37 @@ public:
      */
     auto calculateSymmetricKey() const;
 
+    /**
+     * @brief Serialize the board into a compact binary encoding.
+     * The encoding is a version byte, a flags byte (current player and whether the history follows), the number of
+     * plays, the 9 bytes of the board and the 9 bytes of the player's pieces (one byte per column, from the column
+     * 0 to the column 8) and, optionally, one byte per play of the history. Without history it takes 21 bytes.
+     * @param buffer The buffer to write to, with room for at least `SERIALIZED_SIZE` bytes (plus the number of plays
+     * if the history is included).
+     * @param withHistory Whether the play history is included. Default value is false. The history is left out when
+     * it is not known (a board built from its bitboards).
+     * @return The number of written bytes.
+     */
+    int serialize(uint8_t *buffer, const bool &withHistory = false) const;
+
+    /**
+     * @brief Rebuild a board from its binary encoding.
+     * @param buffer The encoded board, as written by `serialize`.
+     * @param size The number of bytes of the buffer.
+     * @param board The board to rebuild. It is only modified if the encoding is valid.
+     * @return The number of read bytes, or 0 if the encoding is not a valid board.
+     */
+    static int deserialize(const uint8_t *buffer, const int &size, Board &board);
+
+    static constexpr uint8_t SERIALIZATION_VERSION{1}; // Version of the binary encoding
+    static constexpr int SERIALIZED_SIZE{21}; // Size of the binary encoding without history
+
+    /**
+     * @brief Get a key that is shared by the current board state and its mirror image.
+     * @return The smallest of the board key and the symmetric key.
+     */
+    uint128_t getCanonicalKey() const;
+
     /**
      * @brief Check if the board is symmetrical.
      * @return True if the board is symmetrical, false otherwise.
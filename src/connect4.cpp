@@ -0,0 +1,174 @@
+#include "connect4.h"
+#include "asyncEngine.hpp"
+#include <memory>
+
+constexpr auto COLS_NUM{9}; // Number of columns
+
+struct c4_engine {
+    AsyncEngine engine; // The engine behind the handle
+
+    c4_engine(const uint32_t &theTableSize) : engine(theTableSize) {};
+};
+
+struct c4_search {
+    std::shared_ptr<SearchHandle> handle; // The search behind the handle
+};
+
+/**
+ * @brief Convert a move of the engine to the C structure.
+ * @param move The move.
+ * @param finished Whether the search finished.
+ * @param info The structure to fill.
+ */
+static void fillInfo(const Engine::Move &move, const bool &finished, c4_search_info *info) {
+    info->column = move.column;
+    info->source = move.source;
+    info->score = move.score;
+    info->depth = move.depth;
+    info->nodes = move.nodes;
+    info->finished = finished ? 1 : 0;
+    info->reserved = 0;
+}
+
+/**
+ * @brief Start a search and wrap its handle.
+ * It throws when the handle or the search thread cannot be created, the entry points catch the exceptions.
+ */
+static c4_search *startSearch(c4_engine *engine, const Board &board, const int32_t &move_time_ms,
+    c4_progress_callback progress, void *user_data) {
+    SearchLimits limits;
+    limits.move_time_ms = move_time_ms > 0 ? move_time_ms : 0;
+
+    Engine::ProgressCallback callback;
+    if (progress != nullptr) {
+        callback = [progress, user_data](const Engine::Move &move) {
+            c4_search_info info;
+            fillInfo(move, false, &info);
+            progress(&info, user_data);
+        };
+    }
+
+    std::unique_ptr<c4_search> search{new c4_search};
+    search->handle = engine->engine.startSearch(board, limits, callback);
+    return search.release();
+}
+
+uint32_t c4_abi_version(void) {
+    return C4_ABI_VERSION;
+}
+
+c4_engine *c4_engine_create(uint32_t table_size) {
+    // No exception can cross the C interface, the tables of the engine may not fit in memory
+    try {
+        return new c4_engine(table_size != 0 ? table_size : (1U << 19) - 1U);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void c4_engine_destroy(c4_engine *engine) {
+    delete engine;
+}
+
+int c4_engine_load_book(c4_engine *engine, const char *path) {
+    if (engine == nullptr || path == nullptr) return 0;
+    try {
+        return engine->engine.loadBook(path) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+c4_search *c4_search_start(c4_engine *engine, const char *moves, int32_t move_time_ms,
+    c4_progress_callback progress, void *user_data) {
+    if (engine == nullptr || moves == nullptr) return nullptr;
+
+    // Replay the game, which must stop at its first line of four
+    Board board;
+    for (auto move{moves}; *move != '\0'; move++) {
+        const auto column{*move - '0'};
+        if (column < 0 || column >= COLS_NUM || !board.isValidPosition(column) || board.checkLastPlayerWin()) {
+            return nullptr;
+        }
+        board.playMove(column);
+    }
+
+    try {
+        return startSearch(engine, board, move_time_ms, progress, user_data);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+c4_search *c4_search_start_serialized(c4_engine *engine, const uint8_t *position, int32_t size,
+    int32_t move_time_ms, c4_progress_callback progress, void *user_data) {
+    if (engine == nullptr || position == nullptr) return nullptr;
+
+    Board board;
+    if (Board::deserialize(position, size, board) == 0) return nullptr;
+
+    try {
+        return startSearch(engine, board, move_time_ms, progress, user_data);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int c4_search_poll(const c4_search *search) {
+    if (search == nullptr) return 0;
+    try {
+        return search->handle->poll() ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+void c4_search_wait(c4_search *search, c4_search_info *info) {
+    if (search == nullptr) return;
+    try {
+        const auto move{search->handle->wait()};
+        if (info != nullptr) fillInfo(move, true, info);
+    } catch (...) {}
+}
+
+int c4_search_wait_for(c4_search *search, int32_t timeout_ms) {
+    if (search == nullptr) return 0;
+    try {
+        return search->handle->waitFor(std::chrono::milliseconds(timeout_ms > 0 ? timeout_ms : 0)) ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+void c4_search_cancel(c4_search *search) {
+    if (search == nullptr) return;
+    try {
+        search->handle->cancel();
+    } catch (...) {}
+}
+
+void c4_search_get_info(const c4_search *search, c4_search_info *info) {
+    if (search == nullptr || info == nullptr) return;
+    try {
+        // Read the flag first, so a finished flag always comes with the final move
+        const auto finished{search->handle->poll()};
+        fillInfo(search->handle->getBestMove(), finished, info);
+    } catch (...) {}
+}
+
+double c4_search_cancel_latency(const c4_search *search) {
+    if (search == nullptr) return -1.0;
+    try {
+        return search->handle->getCancelLatency();
+    } catch (...) {
+        return -1.0;
+    }
+}
+
+void c4_search_release(c4_search *search) {
+    if (search == nullptr) return;
+    try {
+        search->handle->cancel();
+    } catch (...) {}
+    delete search;
+}
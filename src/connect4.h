@@ -0,0 +1,103 @@
+#ifndef CONNECT4_H
+#define CONNECT4_H
+
+/*
+ * C interface of the engine, exported by libconnect4.so (`make shared`).
+ * The engine and the searches are opaque handles and every structure has fixed-width fields, so the interface does
+ * not depend on the C++ types of the library. A new version only adds functions or appends fields at the end of the
+ * structures; C4_ABI_VERSION tells which version the caller was compiled against.
+ * The functions that take the same engine must not be called at the same time from different threads. The search
+ * functions (poll, wait, cancel, get_info) can be called from any thread, and the progress callbacks run on the
+ * search thread. No exception crosses the interface: the errors are reported by the return values. The search
+ * functions accept a NULL search, for which they return 0 (-1 for the cancel latency) or do nothing.
+ */
+
+#include <stdint.h>
+
+#if defined(__GNUC__)
+#define C4_API __attribute__((visibility("default")))
+#else
+#define C4_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define C4_ABI_VERSION 1
+
+/* The way a move was chosen (same values as Engine::MoveSource). */
+#define C4_SOURCE_WINNING 0
+#define C4_SOURCE_FORCED 1
+#define C4_SOURCE_BOOK 2
+#define C4_SOURCE_SOLVED 3
+#define C4_SOURCE_HEURISTIC 4
+#define C4_SOURCE_PROVEN 5
+
+typedef struct c4_engine c4_engine;
+typedef struct c4_search c4_search;
+
+/* The best move of a search. */
+typedef struct c4_search_info {
+    int32_t column; /* The column to play, -1 if no move was found yet or the game is over */
+    int32_t source; /* One of the C4_SOURCE values */
+    int32_t score; /* Score of the position for the player to move, 0 when it is not known */
+    int32_t depth; /* Deepest ply searched below the position */
+    uint64_t nodes; /* Number of explored nodes */
+    int32_t finished; /* 1 once the search finished, 0 before */
+    int32_t reserved; /* Always 0 */
+} c4_search_info;
+
+/* Called on the search thread with the best move so far. */
+typedef void (*c4_progress_callback)(const c4_search_info *info, void *user_data);
+
+/* Get the version of the interface implemented by the library. */
+C4_API uint32_t c4_abi_version(void);
+
+/* Create an engine with a transposition table of table_size entries (0 for the default size). Returns NULL on error. */
+C4_API c4_engine *c4_engine_create(uint32_t table_size);
+
+/* Cancel the running search of the engine, wait for its end and free the engine. */
+C4_API void c4_engine_destroy(c4_engine *engine);
+
+/* Map an opening book. Returns 1 on success, 0 otherwise. */
+C4_API int c4_engine_load_book(c4_engine *engine, const char *path);
+
+/*
+ * Start the search of a position given by its played columns ("4435", one digit per move). The previous search of
+ * the engine is cancelled. move_time_ms is the time limit, 0 for none. Returns NULL if the moves are not a valid game
+ * or if the search cannot be started.
+ */
+C4_API c4_search *c4_search_start(c4_engine *engine, const char *moves, int32_t move_time_ms,
+    c4_progress_callback progress, void *user_data);
+
+/* Same as c4_search_start with a position encoded by Board::serialize. */
+C4_API c4_search *c4_search_start_serialized(c4_engine *engine, const uint8_t *position, int32_t size,
+    int32_t move_time_ms, c4_progress_callback progress, void *user_data);
+
+/* Return 1 if the search finished, 0 otherwise. Never blocks. */
+C4_API int c4_search_poll(const c4_search *search);
+
+/* Wait for the end of the search and write its result. */
+C4_API void c4_search_wait(c4_search *search, c4_search_info *info);
+
+/* Wait at most timeout_ms milliseconds. Returns 1 if the search finished, 0 otherwise. */
+C4_API int c4_search_wait_for(c4_search *search, int32_t timeout_ms);
+
+/* Ask the search to stop, without waiting. */
+C4_API void c4_search_cancel(c4_search *search);
+
+/* Write the best move so far (or the result once the search finished). */
+C4_API void c4_search_get_info(const c4_search *search, c4_search_info *info);
+
+/* Milliseconds between the cancel request and the end of the search, -1 if not cancelled or not finished. */
+C4_API double c4_search_cancel_latency(const c4_search *search);
+
+/* Cancel the search if it is still running and free the handle. */
+C4_API void c4_search_release(c4_search *search);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
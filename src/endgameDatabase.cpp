@@ -0,0 +1,315 @@
+#include "endgameDatabase.hpp"
+#include "general.hpp"
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+
+constexpr auto CELLS_NUM{63}; // Number of playable cells of the board
+constexpr auto COLS_NUM{9}; // Number of columns
+constexpr uint32_t MAGIC{0x47453443}; // File signature ("C4EG")
+constexpr uint32_t VERSION{2}; // File format version
+constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15ULL}; // Odd constant used to derive the slot seeds
+
+/**
+ * @brief Mix the bits of a 64-bit integer (splitmix64 finalizer).
+ * @param x The integer to mix.
+ * @return The mixed integer.
+ */
+static uint64_t mix(uint64_t x) {
+    x += GOLDEN_RATIO;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Hash a 128-bit key, given by its two halves, with a seed.
+ * @param head The most significant 64 bits of the key.
+ * @param tail The least significant 64 bits of the key.
+ * @param seed The seed of the hash function.
+ * @return The hash of the key.
+ */
+static uint64_t hashKey(const uint64_t head, const uint64_t tail, const uint64_t seed) {
+    return mix(tail ^ mix(head ^ seed));
+}
+
+/**
+ * @brief Hash of a pair of 64-bit integers, used by the containers of the generator.
+ */
+struct KeyHash {
+    size_t operator()(const std::pair<uint64_t, uint64_t> &key) const {
+        return hashKey(key.first, key.second, 0ULL);
+    }
+};
+
+/**
+ * @brief State shared by the recursive functions of the generator.
+ */
+struct Enumeration {
+    int max_empty; // Maximum number of empty cells of the stored positions
+    std::unordered_map<std::pair<uint64_t, uint64_t>, uint8_t, KeyHash> values; // Values of the late positions
+    std::unordered_set<std::pair<uint64_t, uint64_t>, KeyHash> visited; // Explored positions before the late ones
+};
+
+/**
+ * @brief Split a canonical key into its two halves.
+ * @param key The canonical key.
+ * @return The most and least significant 64 bits of the key.
+ */
+static std::pair<uint64_t, uint64_t> splitKey(const uint128_t &key) {
+    return {(uint64_t)(key >> 64), (uint64_t)key};
+}
+
+/**
+ * @brief Compute the value of a late position and of all the late positions reachable from it.
+ * @param board The late position. It is restored before returning.
+ * @param enumeration The state of the generator.
+ * @return The value of the position for the player to move.
+ */
+static uint8_t evaluate(Board &board, Enumeration &enumeration) {
+    const auto key{splitKey(board.getCanonicalKey())};
+    const auto found{enumeration.values.find(key)};
+    if (found != enumeration.values.end()) return found->second;
+
+    // A full board without a line of four is a draw
+    uint8_t value{board.getNumberOfPlays() == CELLS_NUM ? EndgameDatabase::DRAW : EndgameDatabase::LOSS};
+
+    // Every child is explored, even after a win is found, so that any search below this position stays covered
+    const auto can_win{board.canWinNext()};
+    for (int column{0}; column < COLS_NUM; column++) {
+        if (!board.isValidPosition(column)) continue;
+
+        board.playMove(column);
+        // A winning move ends the game, the others lead to the positions of a search started after a missed win
+        const uint8_t child_value = can_win && board.checkLastPlayerWin() ? EndgameDatabase::WIN
+            : EndgameDatabase::WIN - evaluate(board, enumeration);
+        board.undoLastMove();
+
+        value = std::max(value, child_value);
+    }
+
+    enumeration.values.emplace(key, value);
+    return value;
+}
+
+/**
+ * @brief Explore the positions between the root and the late positions.
+ * @param board The position to explore. It is restored before returning.
+ * @param enumeration The state of the generator.
+ */
+static void explore(Board &board, Enumeration &enumeration) {
+    if (CELLS_NUM - board.getNumberOfPlays() <= enumeration.max_empty) {
+        evaluate(board, enumeration);
+        return;
+    }
+
+    // Explore every position only once
+    if (!enumeration.visited.insert(splitKey(board.getCanonicalKey())).second) return;
+
+    // The moves that do not win are explored too, since a search can start after a missed win
+    const auto can_win{board.canWinNext()};
+    for (int column{0}; column < COLS_NUM; column++) {
+        if (!board.isValidPosition(column)) continue;
+
+        board.playMove(column);
+        if (!can_win || !board.checkLastPlayerWin()) explore(board, enumeration);
+        board.undoLastMove();
+    }
+}
+
+EndgameDatabase::EndgameDatabase()
+    : max_empty(-1), root_plays(0), seed(0ULL), positions_num(0ULL), slots_num(0ULL) {};
+
+uint64_t EndgameDatabase::calculateSlot(const uint128_t &key) const {
+    const auto head{(uint64_t)(key >> 64)};
+    const auto tail{(uint64_t)key};
+    const auto bucket{hashKey(head, tail, seed) % bucket_seeds.size()};
+    return hashKey(head, tail, seed ^ ((bucket_seeds[bucket] + 1ULL) * GOLDEN_RATIO)) % slots_num;
+}
+
+void EndgameDatabase::build(const std::vector<uint128_t> &keys, const std::vector<uint8_t> &values) {
+    positions_num = keys.size();
+    slots_num = positions_num + positions_num / 8 + 1; // 89% load factor
+    const auto buckets_num{positions_num / 4 + 1}; // Four keys per bucket on average
+
+    std::vector<uint64_t> heads(positions_num), tails(positions_num);
+    for (uint64_t idx{0}; idx < positions_num; idx++) {
+        heads[idx] = (uint64_t)(keys[idx] >> 64);
+        tails[idx] = (uint64_t)keys[idx];
+    }
+
+    std::vector<uint64_t> bucket_start(buckets_num + 1);
+    std::vector<uint64_t> bucket_keys(positions_num);
+    std::vector<uint64_t> bucket_order(buckets_num);
+    std::vector<bool> occupied(slots_num);
+    std::vector<uint64_t> slots;
+
+    // Try new seeds until every bucket finds a seed that sends its keys to free slots
+    for (seed = 0ULL;; seed++) {
+        // Group the keys by bucket
+        std::fill(bucket_start.begin(), bucket_start.end(), 0ULL);
+        for (uint64_t idx{0}; idx < positions_num; idx++) {
+            bucket_start[hashKey(heads[idx], tails[idx], seed) % buckets_num + 1]++;
+        }
+        for (uint64_t bucket{0}; bucket < buckets_num; bucket++) {
+            bucket_start[bucket + 1] += bucket_start[bucket];
+        }
+        std::vector<uint64_t> bucket_fill(bucket_start.begin(), bucket_start.end() - 1);
+        for (uint64_t idx{0}; idx < positions_num; idx++) {
+            bucket_keys[bucket_fill[hashKey(heads[idx], tails[idx], seed) % buckets_num]++] = idx;
+        }
+
+        // Place the biggest buckets first, while the table is still empty
+        for (uint64_t bucket{0}; bucket < buckets_num; bucket++) bucket_order[bucket] = bucket;
+        std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](const uint64_t lhs, const uint64_t rhs) {
+            return bucket_start[lhs + 1] - bucket_start[lhs] > bucket_start[rhs + 1] - bucket_start[rhs];
+        });
+
+        bucket_seeds.assign(buckets_num, 0);
+        std::fill(occupied.begin(), occupied.end(), false);
+        auto placed{true};
+
+        for (const auto bucket : bucket_order) {
+            if (bucket_start[bucket + 1] == bucket_start[bucket]) break;
+
+            auto found{false};
+            for (uint32_t bucket_seed{0}; bucket_seed <= UINT16_MAX && !found; bucket_seed++) {
+                const auto slot_seed{seed ^ ((bucket_seed + 1ULL) * GOLDEN_RATIO)};
+                slots.clear();
+                found = true;
+                for (auto idx{bucket_start[bucket]}; idx < bucket_start[bucket + 1] && found; idx++) {
+                    const auto key{bucket_keys[idx]};
+                    const auto slot{hashKey(heads[key], tails[key], slot_seed) % slots_num};
+                    found = !occupied[slot] && std::find(slots.begin(), slots.end(), slot) == slots.end();
+                    slots.push_back(slot);
+                }
+                if (found) bucket_seeds[bucket] = (uint16_t)bucket_seed;
+            }
+
+            if (!found) {
+                placed = false;
+                break;
+            }
+            for (const auto slot : slots) occupied[slot] = true;
+        }
+
+        if (placed) break;
+    }
+
+    // Store the values in the slots of their keys
+    packed_values.assign((slots_num + 3) / 4, 0);
+    for (uint64_t idx{0}; idx < positions_num; idx++) {
+        const auto slot{calculateSlot(keys[idx])};
+        packed_values[slot / 4] |= values[idx] << (2 * (slot % 4));
+    }
+}
+
+void EndgameDatabase::generate(Board &root, const int &theMaxEmpty) {
+    #ifdef DEBUG
+    assertError(0 <= theMaxEmpty, "Invalid number of empty cells. It cannot be negative!");
+    assertLogic(!root.checkLastPlayerWin(), "The root position of the endgame database cannot be a finished game.");
+    #endif
+
+    max_empty = theMaxEmpty;
+    root_board = root.getBoard();
+    root_player_pieces = root.getPlayerPieces();
+    root_plays = root.getNumberOfPlays();
+
+    Enumeration enumeration;
+    enumeration.max_empty = theMaxEmpty;
+    explore(root, enumeration);
+    enumeration.visited.clear();
+
+    std::vector<uint128_t> keys;
+    std::vector<uint8_t> values;
+    keys.reserve(enumeration.values.size());
+    values.reserve(enumeration.values.size());
+    for (const auto &[key, value] : enumeration.values) {
+        keys.emplace_back(key.first, key.second);
+        values.push_back(value);
+    }
+    enumeration.values.clear();
+
+    build(keys, values);
+}
+
+bool EndgameDatabase::isBelowRoot(const Board &board) const {
+    const auto plays{board.getNumberOfPlays()};
+    if (max_empty < 0 || plays < root_plays) return false;
+
+    // Every piece of the root position must be on the board, with the same owner
+    if ((root_board & ~board.getBoard()) != uint128_t{0ULL, 0ULL}) return false;
+    const auto pieces{(plays - root_plays) % 2 == 0 ? board.getPlayerPieces() : board.getOpponentPieces()};
+    return (pieces & root_board) == root_player_pieces;
+}
+
+bool EndgameDatabase::covers(const Board &board) const {
+    return CELLS_NUM - board.getNumberOfPlays() <= max_empty && isBelowRoot(board);
+}
+
+EndgameDatabase::Value EndgameDatabase::probe(const Board &board) const {
+    #ifdef DEBUG
+    assertLogic(covers(board), "The probed position is not covered by the endgame database.");
+    #endif
+
+    const auto slot{calculateSlot(board.getCanonicalKey())};
+    return (Value)((packed_values[slot / 4] >> (2 * (slot % 4))) & 3);
+}
+
+int EndgameDatabase::getMaxEmpty() const {
+    return max_empty;
+}
+
+uint64_t EndgameDatabase::getPositionsNum() const {
+    return positions_num;
+}
+
+uint64_t EndgameDatabase::getMemoryUsage() const {
+    return bucket_seeds.size() * sizeof(uint16_t) + packed_values.size();
+}
+
+bool EndgameDatabase::save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    const uint64_t header[] {
+        MAGIC, VERSION, (uint64_t)max_empty, (uint64_t)(root_board >> 64), (uint64_t)root_board,
+        (uint64_t)(root_player_pieces >> 64), (uint64_t)root_player_pieces, (uint64_t)root_plays,
+        seed, positions_num, slots_num, bucket_seeds.size(), packed_values.size()
+    };
+    file.write((const char *)header, sizeof(header));
+    file.write((const char *)bucket_seeds.data(), bucket_seeds.size() * sizeof(uint16_t));
+    file.write((const char *)packed_values.data(), packed_values.size());
+
+    return file.good();
+}
+
+bool EndgameDatabase::load(const std::string &path) {
+    *this = EndgameDatabase();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    uint64_t header[13];
+    file.read((char *)header, sizeof(header));
+    if (!file.good() || header[0] != MAGIC || header[1] != VERSION) return false;
+
+    bucket_seeds.resize(header[11]);
+    packed_values.resize(header[12]);
+    file.read((char *)bucket_seeds.data(), bucket_seeds.size() * sizeof(uint16_t));
+    file.read((char *)packed_values.data(), packed_values.size());
+    if (!file.good()) {
+        *this = EndgameDatabase();
+        return false;
+    }
+
+    max_empty = (int)header[2];
+    root_board = uint128_t{header[3], header[4]};
+    root_player_pieces = uint128_t{header[5], header[6]};
+    root_plays = (int)header[7];
+    seed = header[8];
+    positions_num = header[9];
+    slots_num = header[10];
+    return true;
+}
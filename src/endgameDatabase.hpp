@@ -0,0 +1,129 @@
+#ifndef ENDGAMEDATABASE_HPP
+#define ENDGAMEDATABASE_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "board.hpp"
+
+/**
+ * @class EndgameDatabase
+ * A perfect-play database of the late positions reachable from a root position.
+ * The generator enumerates every position reachable from the root (without any line of four on the board) that has at
+ * most `max_empty` empty cells, deduplicated by the canonical key, and computes its win/draw/loss value from the leaves
+ * backwards. The positions reached after a missed immediate win are enumerated too, since a search can start there. The
+ * values are stored with 2 bits per position, indexed by a perfect hash of the canonical key (hash-and-displace: every
+ * bucket of about four keys stores a 16-bit seed that sends its keys to free slots).
+ * A probe is a couple of hash computations and a single memory access, with no key stored in the table, so it is only
+ * valid for the positions covered by the database. A position is covered when it has at most `max_empty` empty cells
+ * and contains the root position, which is always the case for the positions explored by a search started from the
+ * root or from one of its descendants.
+ */
+class EndgameDatabase {
+private:
+    int max_empty; // Maximum number of empty cells of the stored positions
+    uint128_t root_board; // The occupied cells of the root position
+    uint128_t root_player_pieces; // The pieces of the player to move in the root position
+    int root_plays; // Number of plays of the root position
+    uint64_t seed; // Seed of the hash function that selects the bucket
+    uint64_t positions_num; // Number of stored positions
+    uint64_t slots_num; // Number of slots of the value table
+    std::vector<uint16_t> bucket_seeds; // Seed of the hash function that selects the slot, for each bucket
+    std::vector<uint8_t> packed_values; // Values of the positions (4 per byte)
+
+    /**
+     * @brief Calculate the slot of a canonical key.
+     * @param key The canonical key.
+     * @return The slot of the key in the value table.
+     */
+    uint64_t calculateSlot(const uint128_t &key) const;
+
+    /**
+     * @brief Build the perfect hash function and the value table for the given positions.
+     * @param keys The canonical keys of the positions.
+     * @param values The values of the positions.
+     */
+    void build(const std::vector<uint128_t> &keys, const std::vector<uint8_t> &values);
+
+public:
+    /**
+     * @brief The value of a position for the player to move.
+     */
+    enum Value : uint8_t {
+        LOSS = 0,
+        DRAW = 1,
+        WIN = 2
+    };
+
+    /**
+     * @brief Constructor.
+     * Initializes an empty database that does not cover any position.
+     */
+    EndgameDatabase();
+
+    /**
+     * @brief Generate the database for the late positions reachable from a root position.
+     * Every position between the root and the late positions is explored once, so the root should not be too far
+     * from the requested number of empty cells.
+     * @param root The root position. It is restored before returning.
+     * @param theMaxEmpty Maximum number of empty cells of the stored positions.
+     */
+    void generate(Board &root, const int &theMaxEmpty);
+
+    /**
+     * @brief Check if a position contains the root position of the database.
+     * Every late position explored by a search started from such a position is covered by the database.
+     * @param board The position to check.
+     * @return True if the root position is contained in the position, false otherwise.
+     */
+    bool isBelowRoot(const Board &board) const;
+
+    /**
+     * @brief Check if a position is covered by the database.
+     * @param board The position to check.
+     * @return True if the position can be probed, false otherwise.
+     */
+    bool covers(const Board &board) const;
+
+    /**
+     * @brief Get the value of a covered position.
+     * @param board The position to probe. It must be covered by the database.
+     * @return The value of the position for the player to move.
+     */
+    Value probe(const Board &board) const;
+
+    /**
+     * @brief Get the maximum number of empty cells of the stored positions.
+     * @return The maximum number of empty cells, or -1 if the database is empty.
+     */
+    int getMaxEmpty() const;
+
+    /**
+     * @brief Get the number of stored positions.
+     * @return The number of stored positions.
+     */
+    uint64_t getPositionsNum() const;
+
+    /**
+     * @brief Get the size of the tables in bytes.
+     * @return The size of the bucket seeds and the packed values.
+     */
+    uint64_t getMemoryUsage() const;
+
+    /**
+     * @brief Save the database to a binary file.
+     * @param path The path of the file.
+     * @return True if the file was written, false otherwise.
+     */
+    bool save(const std::string &path) const;
+
+    /**
+     * @brief Load the database from a binary file created by `save`.
+     * @param path The path of the file.
+     * @return True if the file was read, false otherwise (the database is left empty).
+     */
+    bool load(const std::string &path);
+
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "engine.hpp"
+#include "general.hpp"
+#include <algorithm>
+
+constexpr auto ROWS_NUM{8}; // Number of rows (including the additional position)
+constexpr auto COLS_NUM{9}; // Number of columns
+
+Engine::Engine(const uint32_t &theTableSize)
+    : solver(theTableSize), proof_node_limit(0ULL) {
+    // Try the columns from the center to the borders
+    for (int idx{0}; idx < COLS_NUM; idx++) {
+        column_order[idx] = COLS_NUM / 2 + (1 - 2 * (idx % 2)) * (idx + 1) / 2;
+    }
+}
+
+bool Engine::loadBook(const std::string &path) {
+    return book.open(path);
+}
+
+uint64_t Engine::getBookSize() const {
+    return book.getSize();
+}
+
+void Engine::setStopFlag(const std::atomic<bool> *theFlag) {
+    solver.setStopFlag(theFlag);
+    prover.setStopFlag(theFlag);
+}
+
+void Engine::setProofNumberLimit(const uint64_t &theNodeLimit) {
+    proof_node_limit = theNodeLimit;
+}
+
+void Engine::newGame() {
+    board = Board{};
+}
+
+void Engine::playMove(const int &column) {
+    board.playMove(column);
+}
+
+void Engine::steal() {
+    #ifdef DEBUG
+    assertLogic(board.getNumberOfPlays() == 1, "Only the first piece of the board can be stolen.");
+    #endif
+
+    // The player to move has no pieces before and after the steal
+    board = Board{board.getBoard(), board.getPlayerPieces(), !board.getCurrentPlayer(), nullptr, 1};
+}
+
+void Engine::setBoard(const Board &theBoard) {
+    board = theBoard;
+}
+
+const Board &Engine::getBoard() const {
+    return board;
+}
+
+bool Engine::shouldSteal() const {
+    if (board.getNumberOfPlays() != 1) return false;
+
+    // The first piece is at the bottom of its column
+    const auto cells{board.getBoard()};
+    for (int column{COLS_NUM / 2 - 1}; column <= COLS_NUM / 2 + 1; column++) {
+        if (((uint64_t)(cells >> (column * ROWS_NUM)) & 1ULL) != 0ULL) return true;
+    }
+    return false;
+}
+
+int Engine::probeBook() const {
+    if (book.getSize() == 0) return -1;
+
+    // The book stores the smallest orientation of each position
+    const auto position{packPosition(board)};
+    const auto mirrored{mirrorPosition(position)};
+    const auto is_mirrored{comparePositions(mirrored, position)};
+    const auto found{book.find(is_mirrored ? mirrored : position)};
+    if (found == nullptr || found->label < 0 || found->label >= COLS_NUM) return -1;
+
+    return is_mirrored ? COLS_NUM - 1 - found->label : found->label;
+}
+
+int Engine::chooseHeuristicMove(const int &mask) const {
+    #ifdef DEBUG
+    assertLogic(mask != 0, "The heuristic move needs at least one candidate column.");
+    #endif
+
+    auto best_column{-1};
+    auto best_score{-1};
+    for (const auto column : column_order) {
+        if ((mask & (1 << column)) == 0) continue;
+
+        const auto score{board.getMoveScore(column)};
+        if (score > best_score) {
+            best_score = score;
+            best_column = column;
+        }
+    }
+    return best_column;
+}
+
+Engine::Move Engine::chooseMove(const std::chrono::steady_clock::time_point &deadline, const ProgressCallback &progress) {
+    const auto plays{board.getNumberOfPlays()};
+    const auto valid{board.getValidPositions()};
+
+    #ifdef DEBUG
+    assertLogic(valid != 0 && !board.checkLastPlayerWin(), "The engine cannot choose a move when the game is over.");
+    #endif
+
+    // Win at once
+    if (board.canWinNext()) {
+        const auto winning{board.getWinningPositions()};
+        for (const auto column : column_order) {
+            if ((winning & (1 << column)) != 0) return Move{column, WINNING, (Solver::CELLS_NUM + 1 - plays) / 2, 0ULL, 0};
+        }
+    }
+
+    // Every move but one loses at once, or all of them do
+    const auto next{board.getNonLosingPositions()};
+    if (next == 0) return Move{chooseHeuristicMove(valid), FORCED, -(Solver::CELLS_NUM - plays) / 2, 0ULL, 0};
+    if ((next & (next - 1)) == 0) return Move{__builtin_ctz(next), FORCED, 0, 0ULL, 0};
+
+    const auto book_column{probeBook()};
+    if (book_column >= 0 && (next & (1 << book_column)) != 0) return Move{book_column, BOOK, 0, 0ULL, 0};
+
+    // Look for a forced win with a bounded proof-number search
+    if (proof_node_limit > 0ULL) {
+        const auto proof_nodes{prover.getNodeCount()};
+        prover.setDeadline(deadline);
+        const auto result{prover.search(board, proof_node_limit)};
+        prover.clearDeadline();
+        if (result == ProofNumberSearch::PROVEN && prover.getProvingMove() >= 0) {
+            return Move{prover.getProvingMove(), PROVEN, 0, prover.getNodeCount() - proof_nodes, 0};
+        }
+    }
+
+    // Solve the non-losing moves until the deadline
+    const auto nodes{solver.getNodeCount()};
+    auto candidates{next};
+    auto best_column{-1};
+    auto best_score{Solver::MIN_SCORE - 1};
+    auto depth{0};
+    solver.setDeadline(deadline);
+    for (const auto column : column_order) {
+        if ((next & (1 << column)) == 0) continue;
+
+        board.playMove(column);
+        const auto score{-solver.solve(board)};
+        board.undoLastMove();
+        depth = std::max(depth, solver.getMaxDepth() + 1);
+        if (solver.isStopped()) break;
+
+        if (score > best_score) {
+            best_score = score;
+            best_column = column;
+        }
+
+        // Forget the moves that are known to lose
+        if (score < 0 && candidates != (1 << column)) candidates &= ~(1 << column);
+
+        if (progress) progress(Move{best_column, HEURISTIC, best_score, solver.getNodeCount() - nodes, depth});
+    }
+    solver.clearDeadline();
+
+    if (!solver.isStopped()) return Move{best_column, SOLVED, best_score, solver.getNodeCount() - nodes, depth};
+
+    // A proven win is good enough, otherwise play a move that is not known to lose
+    if (best_score > 0) return Move{best_column, SOLVED, best_score, solver.getNodeCount() - nodes, depth};
+    return Move{chooseHeuristicMove(candidates), HEURISTIC, 0, solver.getNodeCount() - nodes, depth};
+}
+
+PackedPosition Engine::makeBookEntry(const Board &theBoard, const int &column) {
+    const auto position{packPosition(theBoard, (int16_t)column)};
+    const auto mirrored{mirrorPosition(position)};
+    if (!comparePositions(mirrored, position)) return position;
+
+    auto entry{mirrored};
+    entry.label = (int16_t)(COLS_NUM - 1 - column);
+    return entry;
+}
+
+bool Engine::parseGrid(const std::vector<std::string> &rows, const char &player, Board &theBoard) {
+    if (rows.size() != ROWS_NUM - 1) return false;
+
+    // Encode the grid like `Board::serialize`, so that the decoding checks the position
+    uint8_t buffer[Board::SERIALIZED_SIZE]{};
+    auto plays{0};
+    for (int row{0}; row < ROWS_NUM - 1; row++) {
+        const auto &line{rows[ROWS_NUM - 2 - row]};
+        if (line.size() < COLS_NUM) return false;
+
+        for (int column{0}; column < COLS_NUM; column++) {
+            const auto cell{line[column]};
+            if (cell == '.') continue;
+            if (cell != '0' && cell != '1') return false;
+
+            buffer[3 + column] |= 1 << row;
+            if (cell == player) buffer[3 + COLS_NUM + column] |= 1 << row;
+            plays++;
+        }
+    }
+
+    // The player to move is the first player when both players have the same number of pieces
+    buffer[0] = Board::SERIALIZATION_VERSION;
+    buffer[1] = plays % 2 == 0 ? 1 : 0;
+    buffer[2] = (uint8_t)plays;
+    return Board::deserialize(buffer, Board::SERIALIZED_SIZE, theBoard) != 0;
+}
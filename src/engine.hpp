@@ -0,0 +1,178 @@
+#ifndef ENGINE_HPP
+#define ENGINE_HPP
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include "board.hpp"
+#include "positionArray.hpp"
+#include "proofNumberSearch.hpp"
+#include "solver.hpp"
+
+/**
+ * @class Engine
+ * The state of a bot for a whole match.
+ * The engine keeps a single Board that is updated move by move, a Solver whose transposition table is kept between
+ * the turns and an optional opening book, memory mapped once. The book is a position array sorted with
+ * `comparePositions` that stores one orientation of each position (the smallest one of the position and its mirror
+ * image) labeled with the column to play in that orientation.
+ */
+class Engine {
+private:
+    Solver solver; // Solver of the positions, with the transposition table of the match
+    ProofNumberSearch prover; // Proof-number search of the pre-check, with its node table of the match
+    uint64_t proof_node_limit; // Node limit of the proof-number pre-check, 0 to skip it
+    Board board; // The current position of the match
+    PositionArray book; // Opening book, possibly empty
+    int column_order[9]; // Order in which the columns are tried (center first)
+
+    /**
+     * @brief Look for the current position in the opening book.
+     * @return The column of the book, or -1 if the position is not in the book.
+     */
+    int probeBook() const;
+
+    /**
+     * @brief Choose a move among some columns without searching.
+     * @param mask The bitmask of the candidate columns. It must not be empty.
+     * @return The column that gives the most winning cells, the most central one for ties.
+     */
+    int chooseHeuristicMove(const int &mask) const;
+
+public:
+    /**
+     * @brief The way a move was chosen.
+     */
+    enum MoveSource {
+        WINNING, // The move wins the game
+        FORCED, // Every other move loses at once (or all of them do)
+        BOOK, // The move comes from the opening book
+        SOLVED, // The move was proven the best one by the solver
+        HEURISTIC, // The search ran out of time
+        PROVEN // The proof-number pre-check proved that the move wins
+    };
+
+    /**
+     * @brief A move chosen by the engine.
+     */
+    struct Move {
+        int column; // The column to play
+        MoveSource source; // The way the move was chosen
+        int score; // The score of the position for the player to move, or 0 when it is not known
+        uint64_t nodes; // Number of nodes explored to choose the move
+        int depth; // Deepest ply searched below the position, 0 without search
+    };
+
+    /**
+     * @brief Function called with the best move found so far, every time the search completes a move.
+     */
+    using ProgressCallback = std::function<void(const Move &)>;
+
+    static constexpr int STEAL{-2}; // Action of the second player that takes the first piece of the board
+
+    /**
+     * @brief Constructor.
+     * Initializes an engine at the start of a match.
+     * @param theTableSize The size of the transposition table. Default value is (1ULL << 19) - 1ULL.
+     */
+    Engine(const uint32_t &theTableSize = (1ULL << 19) - 1ULL);
+
+    /**
+     * @brief Map an opening book.
+     * @param path The path of the book.
+     * @return True if the book was mapped, false otherwise (the engine plays without book).
+     */
+    bool loadBook(const std::string &path);
+
+    /**
+     * @brief Get the number of positions of the opening book.
+     * @return The number of positions of the book.
+     */
+    uint64_t getBookSize() const;
+
+    /**
+     * @brief Set a flag that stops the searches of `chooseMove` when another thread raises it.
+     * @param theFlag The stop flag, or null to remove it. It must outlive the searches.
+     */
+    void setStopFlag(const std::atomic<bool> *theFlag);
+
+    /**
+     * @brief Run a proof-number search before the main search of `chooseMove`.
+     * When it proves a win within its node limit, its winning move is played without solving the position. The
+     * proof is not the fastest win, so the score of the move is unknown. The pre-check stops at the deadline or when
+     * the stop flag is raised, like the main search, and the moves are then solved with the time left.
+     * @param theNodeLimit The maximum number of nodes of the pre-check, 0 to disable it (the default).
+     */
+    void setProofNumberLimit(const uint64_t &theNodeLimit);
+
+    /**
+     * @brief Start a new match. The transposition table is kept.
+     */
+    void newGame();
+
+    /**
+     * @brief Play a move of any of the players.
+     * @param column The column of the move. It must be a valid position.
+     */
+    void playMove(const int &column);
+
+    /**
+     * @brief Take the first piece of the board, as the second player.
+     * The piece changes hands and the first player moves again, so only the current player changes.
+     */
+    void steal();
+
+    /**
+     * @brief Replace the current position, when the position of the referee does not match the engine one.
+     * @param theBoard The new position.
+     */
+    void setBoard(const Board &theBoard);
+
+    /**
+     * @brief Get the current position.
+     * @return The current position.
+     */
+    const Board &getBoard() const;
+
+    /**
+     * @brief Check if the second player should steal the first piece.
+     * @return True if the first piece of the board is in one of the three central columns, false otherwise.
+     */
+    bool shouldSteal() const;
+
+    /**
+     * @brief Choose the move of the current player.
+     * Immediate wins and forced moves are played at once, then the book is probed and finally every non-losing move
+     * is solved until the deadline. If the time is over, the move is chosen among the moves that are not known to
+     * lose with `chooseHeuristicMove`. The game must not be over.
+     * @param deadline The time at which the search is stopped.
+     * @param progress Function called after every solved move with the best move so far (as a HEURISTIC move until
+     * every move is solved). Can be empty.
+     * @return The chosen move.
+     */
+    Move chooseMove(const std::chrono::steady_clock::time_point &deadline,
+        const ProgressCallback &progress = ProgressCallback());
+
+    /**
+     * @brief Build the book entry of a position.
+     * @param theBoard The position.
+     * @param column The column to play from the position.
+     * @return The smallest orientation of the position, labeled with the column to play in that orientation.
+     */
+    static PackedPosition makeBookEntry(const Board &theBoard, const int &column);
+
+    /**
+     * @brief Build a position from the rows of the Codingame grid.
+     * @param rows The 7 rows of the grid from the top to the bottom, 9 characters each (`0`, `1` or `.`).
+     * @param player The character of the player to move.
+     * @param theBoard The board to build. It is only modified if the grid is a valid position.
+     * @return True if the grid is a valid position, false otherwise.
+     */
+    static bool parseGrid(const std::vector<std::string> &rows, const char &player, Board &theBoard);
+
+};
+
+#endif
@@ -0,0 +1,153 @@
+#include "gameRecord.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+constexpr auto CELLS_NUM{63}; // Number of playable cells of the board
+constexpr auto COLS_NUM{9}; // Number of columns
+
+GameRecordReader::GameRecordReader()
+    : data(nullptr), size(0) {};
+
+GameRecordReader::~GameRecordReader() {
+    close();
+}
+
+bool GameRecordReader::open(const std::string &path) {
+    close();
+
+    const auto file{::open(path.c_str(), O_RDONLY)};
+    if (file < 0) return false;
+
+    struct stat status;
+    if (fstat(file, &status) != 0) {
+        ::close(file);
+        return false;
+    }
+
+    size = status.st_size;
+    if (size > 0) {
+        void *memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (memory == MAP_FAILED) {
+            ::close(file);
+            size = 0;
+            return false;
+        }
+        // The file is read once from the beginning to the end
+        madvise(memory, size, MADV_SEQUENTIAL);
+        data = static_cast<const char *>(memory);
+    }
+
+    // The mapping stays valid after closing the file descriptor
+    ::close(file);
+    return true;
+}
+
+void GameRecordReader::close() {
+    if (data != nullptr) munmap((void *)data, size);
+    data = nullptr;
+    size = 0;
+}
+
+GameRecordReader::GameResult GameRecordReader::replayGame(const char *begin, const char *end, Board &board, uint128_t *keys) {
+    for (auto move{begin}; move != end; move++) {
+        // Moves after the end of the game
+        if (board.checkLastPlayerWin() || board.getNumberOfPlays() == CELLS_NUM) return INVALID;
+
+        const auto column{*move - '0'};
+        if (column < 0 || column >= COLS_NUM || !board.isValidPosition(column)) return INVALID;
+
+        if (keys != nullptr) keys[board.getNumberOfPlays()] = board.getBoardKey();
+        board.playMove(column);
+    }
+
+    if (board.checkLastPlayerWin()) return board.getNumberOfPlays() % 2 == 1 ? FIRST_PLAYER_WIN : SECOND_PLAYER_WIN;
+    if (board.getNumberOfPlays() == CELLS_NUM) return DRAW;
+    return UNFINISHED;
+}
+
+ReplayStats GameRecordReader::replay(const int &threads_num, const Callback &callback, const size_t &chunk_size) const {
+    const auto start{std::chrono::steady_clock::now()};
+    const auto chunks_num{(size + chunk_size - 1) / chunk_size};
+    std::atomic<size_t> next_chunk{0};
+    std::vector<ReplayStats> thread_stats(std::max(threads_num, 1));
+
+    auto worker = [&](const int thread) {
+        auto &stats{thread_stats[thread]};
+        uint128_t keys[CELLS_NUM];
+
+        for (auto chunk{next_chunk++}; chunk < chunks_num; chunk = next_chunk++) {
+            const auto chunk_begin{data + chunk * chunk_size};
+            const auto chunk_end{data + std::min(size, (chunk + 1) * chunk_size)};
+            const auto file_end{data + size};
+
+            // A line belongs to the chunk of its first character
+            auto line{chunk_begin};
+            if (chunk > 0 && *(line - 1) != '\n') {
+                line = std::find(line, chunk_end, '\n');
+                if (line != chunk_end) line++;
+            }
+
+            while (line < chunk_end) {
+                const auto line_end{std::find(line, file_end, '\n')};
+                auto game_end{line_end};
+                if (game_end != line && *(game_end - 1) == '\r') game_end--;
+
+                if (game_end != line) {
+                    Board board;
+                    const auto result{replayGame(line, game_end, board, keys)};
+                    stats.games++;
+
+                    switch (result) {
+                        case FIRST_PLAYER_WIN: stats.first_player_wins++; break;
+                        case SECOND_PLAYER_WIN: stats.second_player_wins++; break;
+                        case DRAW: stats.draws++; break;
+                        case UNFINISHED: stats.unfinished_games++; break;
+                        case INVALID: stats.invalid_games++; break;
+                    }
+
+                    if (result != INVALID) {
+                        const auto plays{board.getNumberOfPlays()};
+                        stats.positions += plays;
+                        if (callback) {
+                            for (int ply{0}; ply < plays; ply++) {
+                                callback(thread, PositionRecord{(uint64_t)(line - data), ply, line[ply] - '0', keys[ply]});
+                            }
+                        }
+                    }
+                }
+
+                line = line_end == file_end ? file_end : line_end + 1;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int thread{1}; thread < threads_num; thread++) {
+        threads.emplace_back(worker, thread);
+    }
+    worker(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ReplayStats total;
+    for (const auto &stats : thread_stats) {
+        total.games += stats.games;
+        total.invalid_games += stats.invalid_games;
+        total.positions += stats.positions;
+        total.first_player_wins += stats.first_player_wins;
+        total.second_player_wins += stats.second_player_wins;
+        total.draws += stats.draws;
+        total.unfinished_games += stats.unfinished_games;
+    }
+    total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return total;
+}
@@ -0,0 +1,114 @@
+#ifndef GAMERECORD_HPP
+#define GAMERECORD_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include "board.hpp"
+
+/**
+ * @brief A position of a replayed game, together with the move that was played from it.
+ */
+struct PositionRecord {
+    uint64_t offset; // Offset of the game in the file (first byte of its line)
+    int ply; // Number of plays before the move
+    int column; // The column played from the position
+    uint128_t key; // The board key of the position
+};
+
+/**
+ * @brief The statistics of a replay.
+ */
+struct ReplayStats {
+    uint64_t games{0}; // Number of games (non-empty lines)
+    uint64_t invalid_games{0}; // Games with an illegal move, an unknown character or moves after the end of the game
+    uint64_t positions{0}; // Number of emitted positions
+    uint64_t first_player_wins{0}; // Games won by the first player
+    uint64_t second_player_wins{0}; // Games won by the second player
+    uint64_t draws{0}; // Games that filled the board without a winner
+    uint64_t unfinished_games{0}; // Valid games that stop before the end
+    double seconds{0.0}; // Wall time of the replay
+};
+
+/**
+ * @class GameRecordReader
+ * A streaming reader of game records.
+ * A game record file has one game per line, written as the sequence of played columns with one digit per move
+ * (`0` to `8`). The file is memory mapped instead of read, so only the pages being replayed are in memory and the
+ * operating system can drop them once they are done. The replay splits the file in chunks (cut at line boundaries)
+ * that the threads take one after the other, replays every game through `Board::playMove`, checks that every move
+ * is legal and that the game stops at the first line of four, and emits one record per position.
+ */
+class GameRecordReader {
+private:
+    const char *data; // The mapped file
+    size_t size; // Size of the mapped file in bytes
+
+public:
+    /**
+     * @brief The result of a replayed game.
+     */
+    enum GameResult {
+        FIRST_PLAYER_WIN,
+        SECOND_PLAYER_WIN,
+        DRAW,
+        UNFINISHED,
+        INVALID
+    };
+
+    /**
+     * @brief Function called for every position of the valid games.
+     * The first argument is the index of the thread that replays the game, so the callers can keep per-thread
+     * results without locking. The positions of a game are emitted once the whole game has been validated.
+     */
+    using Callback = std::function<void(const int, const PositionRecord &)>;
+
+    /**
+     * @brief Constructor.
+     * Initializes a reader without any file.
+     */
+    GameRecordReader();
+
+    GameRecordReader(const GameRecordReader &other) = delete;
+    GameRecordReader &operator=(const GameRecordReader &other) = delete;
+
+    /**
+     * @brief Destructor for the GameRecordReader class.
+     */
+    ~GameRecordReader();
+
+    /**
+     * @brief Map a game record file.
+     * @param path The path of the file.
+     * @return True if the file was mapped, false otherwise.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Unmap the current file.
+     */
+    void close();
+
+    /**
+     * @brief Replay all the games of the file in parallel.
+     * @param threads_num The number of threads.
+     * @param callback Function called for every position of the valid games. Can be empty.
+     * @param chunk_size The size of the chunks taken by the threads, in bytes. Default value is 4 MiB.
+     * @return The statistics of the replay.
+     */
+    ReplayStats replay(const int &threads_num, const Callback &callback = Callback(), const size_t &chunk_size = 1ULL << 22) const;
+
+    /**
+     * @brief Replay a single game.
+     * @param begin The first character of the game.
+     * @param end The character past the last one of the game.
+     * @param board An empty board, used to replay the game. It is left in the final position of the game.
+     * @param keys Optional array of 63 keys, filled with the board key of the position before each move.
+     * @return The result of the game.
+     */
+    static GameResult replayGame(const char *begin, const char *end, Board &board, uint128_t *keys = nullptr);
+
+};
+
+#endif
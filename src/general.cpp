@@ -2,7 +2,7 @@
 
 #include <fstream>
 
-void assertError(bool condition, const std::string& errorMessage) {
+void assertError(bool condition, const char *errorMessage) {
     if (!condition) {
         // Register the error in a log file
         std::ofstream errorLog("error_log.txt", std::ios::app);
@@ -16,7 +16,7 @@ void assertError(bool condition, const std::string& errorMessage) {
     }
 }
 
-void assertOverflow(bool condition, const std::string& errorMessage) {
+void assertOverflow(bool condition, const char *errorMessage) {
     if (!condition) {
         // Register the error in a log file
         std::ofstream errorLog("error_log.txt", std::ios::app);
@@ -30,7 +30,7 @@ void assertOverflow(bool condition, const std::string& errorMessage) {
     }
 }
 
-void assertLogic(bool condition, const std::string& errorMessage) {
+void assertLogic(bool condition, const char *errorMessage) {
     if (!condition) {
         // Register the error in a log file
         std::ofstream errorLog("error_log.txt", std::ios::app);
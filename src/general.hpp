@@ -10,7 +10,7 @@
  * @throws std::runtime_error if the condition is false.
  * @remarks This function logs the error message to a log file.
  */
-void assertError(bool condition, const std::string& errorMessage);
+void assertError(bool condition, const char *errorMessage);
 
 /**
  * Checks a condition and logs an error if the condition is false.
@@ -19,7 +19,7 @@ void assertError(bool condition, const std::string& errorMessage);
  * @throws std::overflow_error if an overflow occurs.
  * @remarks This function logs the error message to a log file.
  */
-void assertOverflow(bool condition, const std::string& errorMessage);
+void assertOverflow(bool condition, const char *errorMessage);
 
 /**
  * Checks a condition and logs an error if the condition is false.
@@ -28,7 +28,7 @@ void assertOverflow(bool condition, const std::string& errorMessage);
  * @throws std::logic_error if a logic error occurs.
  * @remarks This function logs the error message to a log file.
  */
-void assertLogic(bool condition, const std::string& errorMessage);
+void assertLogic(bool condition, const char *errorMessage);
 
 #endif
 
@@ -1,34 +1,112 @@
 #include "hashMap.hpp"
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 
-HashMap::HashMap(const uint32_t &theSize)
-    : size{theSize} {
-        table = new Data[theSize];
-    }
+constexpr uint32_t SHARED_MAGIC{0x54543443}; // Signature of a shared table ("C4TT"), written once it is initialized
+constexpr uint32_t SHARED_VERSION{1}; // Layout version of a shared table
+
+/**
+ * @brief The header of a shared memory segment, followed by the entries.
+ */
+struct SharedHeader {
+    uint32_t magic; // Signature, zero while the creator initializes the entries
+    uint32_t version; // Layout version
+    uint32_t size; // Number of entries
+    uint32_t entry_size; // Size of an entry in bytes, also keeps the entries aligned to 8 bytes
+};
 
-HashMap::HashMap(const HashMap &other) {
-    table = new Data[size];
-    *table = *other.table;
+/**
+ * @brief Get the size of a shared memory segment.
+ * @param size The number of entries.
+ * @param entry_size The size of an entry in bytes.
+ * @return The size in bytes.
+ */
+static uint64_t getSegmentSize(const uint32_t &size, const uint64_t &entry_size) {
+    return sizeof(SharedHeader) + (uint64_t)size * entry_size;
 }
 
-HashMap::HashMap(HashMap &&other)
-    : table{other.table} {
-        other.table = nullptr;
+SharedSegment SharedSegment::open(const std::string &name, const uint64_t &entrySize, const uint32_t &size) {
+    SharedSegment segment;
+
+    // Create the segment, or open the one created by another process
+    segment.created = true;
+    auto fd{shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600)};
+    if (fd < 0 && errno == EEXIST) {
+        segment.created = false;
+        fd = shm_open(name.c_str(), O_RDWR, 0600);
+    }
+    if (fd < 0) return SharedSegment{};
+
+    uint64_t bytes{getSegmentSize(size, entrySize)};
+    if (segment.created) {
+        if (ftruncate(fd, bytes) != 0) {
+            ::close(fd);
+            shm_unlink(name.c_str());
+            return SharedSegment{};
+        }
+    } else {
+        // The creator may not have sized the segment yet
+        struct stat status;
+        const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds(1)};
+        while (fstat(fd, &status) == 0 && (uint64_t)status.st_size < sizeof(SharedHeader) &&
+            std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (fstat(fd, &status) != 0 || (uint64_t)status.st_size < sizeof(SharedHeader)) {
+            ::close(fd);
+            return SharedSegment{};
+        }
+        bytes = status.st_size;
+    }
+
+    const auto mapping{mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        if (segment.created) shm_unlink(name.c_str());
+        return SharedSegment{};
+    }
+
+    const auto header{static_cast<SharedHeader *>(mapping)};
+    if (segment.created) {
+        header->version = SHARED_VERSION;
+        header->size = size;
+        header->entry_size = (uint32_t)entrySize;
+    } else {
+        const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds(1)};
+        while (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHARED_MAGIC &&
+            std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHARED_MAGIC || header->version != SHARED_VERSION ||
+            header->entry_size != entrySize || header->size == 0 || bytes != getSegmentSize(header->size, entrySize)) {
+            munmap(mapping, bytes);
+            return SharedSegment{};
+        }
     }
 
-HashMap::~HashMap() {
-    delete[] table;
+    segment.mapping = mapping;
+    segment.bytes = bytes;
+    segment.entries = static_cast<char *>(mapping) + sizeof(SharedHeader);
+    segment.size = header->size;
+    return segment;
 }
 
-void HashMap::put(const uint64_t &key, const uint8_t &value) {
-    uint32_t idx = calculateIndex(key);
-    table[idx].key = key;
-    table[idx].value = value;
+void SharedSegment::publish() {
+    __atomic_store_n(&static_cast<SharedHeader *>(mapping)->magic, SHARED_MAGIC, __ATOMIC_RELEASE);
+    created = false;
 }
 
-uint8_t HashMap::get(const uint64_t &key) const {
-    uint32_t idx = calculateIndex(key);
-    if (table[idx].key == key) {
-        return table[idx].value;
-    }
-    return DEADCODE;
+void SharedSegment::close() {
+    if (mapping != nullptr) munmap(mapping, bytes);
+    mapping = nullptr;
+    entries = nullptr;
+}
+
+bool SharedSegment::remove(const std::string &name) {
+    return shm_unlink(name.c_str()) == 0;
 }
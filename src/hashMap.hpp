@@ -2,43 +2,197 @@
 #define HASHMAP_HPP
 
 #include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "../external/libs/uint128_API.hpp"
 
 /**
- * @brief The HashMap class represents a hash map data structure.
+ * @brief The default entry of a HashMap: the 56 least significant bits of a key and an 8-bit value.
+ * An entry type has a `Value` type, an `EMPTY` value returned for the missing keys, a default constructor that builds
+ * an empty entry, a constructor from a key and a value, `matches` to check the stored key and `getValue`.
  */
-class HashMap {
-private:
+class ValueEntry {
+public:
+    using Value = uint8_t;
+
+    static constexpr uint8_t DEADCODE{(uint8_t)0xDEADC0DE}; // No data (number 222).
+    static constexpr Value EMPTY{DEADCODE}; // Value of the missing keys.
+
+    uint64_t key : 56; // The key of the key-value pair (56-bits).
+    uint8_t value; // The value associated with the key.
+
     /**
-     * @brief The Data class represents a key-value pair stored in the hash map.
+     * @brief Constructs an empty entry.
      */
-    class Data {
-    public:
-        uint64_t key : 56; // The key of the key-value pair (56-bits).
-        uint8_t value; // The value associated with the key.
+    ValueEntry()
+        : key(0ULL), value(DEADCODE) {};
 
-        /**
-         * @brief Constructs a Data object with default values.
-         */
-        Data()
-            : key(0ULL), value(DEADCODE) {};
-    };
+    /**
+     * @brief Constructs an entry from a key, of which only the 56 least significant bits are kept, and a value.
+     */
+    ValueEntry(const uint64_t &theKey, const Value &theValue)
+        : key(theKey), value(theValue) {};
 
-    Data* table;
+    /**
+     * @brief Constructs an entry from a 128-bit key, of which only the 56 least significant bits are kept, and a value.
+     */
+    ValueEntry(const uint128_t &theKey, const Value &theValue)
+        : key((uint64_t) theKey), value(theValue) {};
 
-    uint32_t size;
+    /**
+     * @brief Check if the entry holds a key.
+     * @param theKey The key.
+     * @return True if the stored bits are the ones of the key.
+     */
+    bool matches(const uint64_t &theKey) const {
+        return key == (theKey & ((1ULL << 56) - 1ULL));
+    }
 
     /**
-     * @brief Helper function to calculate the index based on the key.
-     * @param key The key to calculate the index for.
-     * @return The calculated index value.
+     * @brief Check if the entry holds a 128-bit key.
+     * @param theKey The key.
+     * @return True if the stored bits are the ones of the key.
      */
-    uint32_t calculateIndex(const uint64_t key) const {
+    bool matches(const uint128_t &theKey) const {
+        return key == ((uint64_t) theKey & ((1ULL << 56) - 1ULL));
+    }
+
+    /**
+     * @brief Get the value of the entry.
+     * @return The value.
+     */
+    Value getValue() const {
+        return value;
+    }
+};
+
+/**
+ * @brief Index policy of a HashMap: the key modulo the size.
+ * When the keys have at most 72 bits (like the board keys) and the size is odd and at least 2^16, the 56 bits stored by
+ * a `ValueEntry` together with the index identify the key without collisions. With a smaller size, the index cannot
+ * recover the 16 high bits of the key.
+ */
+struct ModuloIndex {
+    static uint32_t calculateIndex(const uint64_t &key, const uint32_t &size) {
         return (uint32_t) (key % size);
     }
 
+    static uint32_t calculateIndex(const uint128_t &key, const uint32_t &size) {
+        return (uint32_t) (uint64_t) (key % (uint64_t) size);
+    }
+};
+
+/**
+ * @brief Index policy of a HashMap: the 32 most significant bits of the key scaled to the size with a multiplication,
+ * which is faster than a division. The keys must be uniform hashes, like the Zobrist hashes of the boards, and the
+ * index does not depend on the low bits of the key, which are the ones stored by the entries.
+ */
+struct RangeIndex {
+    static uint32_t calculateIndex(const uint64_t &key, const uint32_t &size) {
+        return (uint32_t) (((key >> 32) * size) >> 32);
+    }
+};
+
+/**
+ * @brief Replace policy of a HashMap: a new entry always replaces the stored one.
+ */
+struct AlwaysReplace {
+    template <typename Entry>
+    static bool shouldReplace(const Entry &, const Entry &) {
+        return true;
+    }
+};
+
+/**
+ * @brief A POSIX shared memory segment holding the entries of a HashMap, independent of their type.
+ */
+struct SharedSegment {
+    void *mapping{nullptr}; // The mapping of the segment, or null if it cannot be created or opened
+    uint64_t bytes{0ULL}; // Size of the mapping
+    void *entries{nullptr}; // First entry, after the header
+    uint32_t size{0}; // Number of entries
+    bool created{false}; // Whether the segment was created, so its entries must be cleared before it is published
+
+    /**
+     * @brief Create a shared memory segment, or open the one created by another process once it is published.
+     * @param name The name of the segment.
+     * @param entrySize The size of an entry, checked against the one of an existing segment.
+     * @param size The number of entries of a created segment.
+     * @return The segment, with a null mapping on failure.
+     */
+    static SharedSegment open(const std::string &name, const uint64_t &entrySize, const uint32_t &size);
+
+    /**
+     * @brief Publish a created segment to the other processes, once its entries are cleared.
+     */
+    void publish();
+
+    /**
+     * @brief Unmap the segment. It stays in shared memory until it is removed.
+     */
+    void close();
+
+    /**
+     * @brief Remove the name of a segment.
+     * @param name The name of the segment.
+     * @return True if the segment existed.
+     */
+    static bool remove(const std::string &name);
+};
+
+/**
+ * @brief The HashMap class represents a hash map data structure, with one entry per index.
+ * The layout of the entries, the index of a key and the choice between a stored entry and a new one are template
+ * policies, so every table gets its own packed entries with no runtime cost. The default map keeps 56 bits of a
+ * 64-bit key and an 8-bit value, at the key modulo the size, always replacing the stored entry.
+ * The table is allocated on the heap, or lives in a POSIX shared memory segment shared by several processes (see
+ * `attachShared`). Every entry is read and written as one machine word, so the key and the value of an entry are
+ * always consistent without locks, even when a process writing to the table dies in the middle of a put.
+ * @tparam Key The type of the keys.
+ * @tparam Entry The type of the entries (see `ValueEntry`), of 1, 2, 4 or 8 bytes.
+ * @tparam IndexPolicy The type with the static `calculateIndex(key, size)` (see `ModuloIndex`).
+ * @tparam ReplacePolicy The type with the static `shouldReplace(stored, entry)` (see `AlwaysReplace`).
+ */
+template <typename Key = uint64_t, typename Entry = ValueEntry, typename IndexPolicy = ModuloIndex,
+    typename ReplacePolicy = AlwaysReplace>
+class HashMap {
+    static_assert(std::is_trivially_copyable<Entry>::value && (sizeof(Entry) == 1 || sizeof(Entry) == 2 ||
+        sizeof(Entry) == 4 || sizeof(Entry) == 8), "An entry must be read and written as one machine word.");
+
+private:
+    Entry* table;
+
+    uint32_t size;
+
+    SharedSegment segment; // The shared memory segment of the table, with a null mapping when the table is on the heap
+
+    /**
+     * @brief Read an entry in one access.
+     */
+    Entry load(const uint32_t &idx) const {
+        Entry entry;
+        __atomic_load(&table[idx], &entry, __ATOMIC_RELAXED);
+        return entry;
+    }
+
+    /**
+     * @brief Write an entry in one access.
+     */
+    void store(const uint32_t &idx, Entry entry) {
+        __atomic_store(&table[idx], &entry, __ATOMIC_RELAXED);
+    }
+
+    /**
+     * @brief Release the table, from the heap or from the shared memory segment.
+     */
+    void release();
+
 public:
-    static const uint8_t DEADCODE{(uint8_t)0xDEADC0DE}; // No data (number 222).
-    
+    using Value = typename Entry::Value;
+
+    static constexpr Value EMPTY{Entry::EMPTY}; // Value of the missing keys.
+
     /**
      * @brief Constructs a HashMap object with a specified size.
      * @param theSize The size of the HashMap. Default value is (1ULL << 19) - 1ULL.
@@ -48,6 +202,7 @@ public:
 
     /**
      * @brief Copy constructor for the HashMap class.
+     * The copy has its own table on the heap, with the entries of the other HashMap, even when that one is shared.
      * @param other The HashMap object to be copied.
      */
     HashMap(const HashMap &other);
@@ -57,26 +212,174 @@ public:
      * @param other The HashMap object to be moved.
      */
     HashMap(HashMap &&other);
-    
+
+    /**
+     * @brief Assignment operator for the HashMap class, by copy or by move.
+     * @param other The HashMap object to be assigned.
+     * @return This HashMap.
+     */
+    HashMap &operator=(HashMap other);
+
     /**
      * @brief Destructor for the HashMap class.
      */
     ~HashMap();
 
     /**
-     * @brief Inserts a key-value pair into the HashMap.
+     * @brief Inserts a key-value pair into the HashMap, if the replace policy prefers it to the stored entry.
+     * The entry may only keep a part of the key (56 bits for a `ValueEntry`), so two keys can share an entry when
+     * they have the same index and the same stored bits.
      * @param key The key to be inserted.
      * @param value The value to be associated with the key.
      */
-    void put(const uint64_t &key, const uint8_t &value);
+    void put(const Key &key, const Value &value);
 
     /**
      * @brief Retrieves the value associated with a given key from the HashMap.
      * @param key The key to retrieve the value for.
-     * @return The value associated with the key.
+     * @return The value associated with the key, or EMPTY.
+     */
+    Value get(const Key &key) const;
+
+    /**
+     * @brief Removes all the key-value pairs from the HashMap.
+     * In shared mode, the entries are removed for every process attached to the table.
      */
-    uint8_t get(const uint64_t &key) const;
+    void clear();
+
+    /**
+     * @brief Moves the table to a POSIX shared memory segment, shared with every process attached to the same name.
+     * The segment is created and cleared with the size of the HashMap if it does not exist, otherwise its content and
+     * its size are kept. The segment outlives the processes that use it until it is removed, so the entries are not
+     * lost when a process crashes. The current entries of the HashMap are discarded.
+     * @param name The name of the segment, like "/connect4_table".
+     * @return True if the table is in the segment, false if it cannot be created or opened, or if its entries have
+     * another size (the table is unchanged).
+     */
+    bool attachShared(const std::string &name);
+
+    /**
+     * @brief Check if the table lives in a shared memory segment.
+     * @return True in shared mode.
+     */
+    bool isShared() const;
+
+    /**
+     * @brief Get the number of entries of the table.
+     * @return The size of the HashMap.
+     */
+    uint32_t getSize() const;
+
+    /**
+     * @brief Removes the name of a shared memory segment. The processes attached to it keep using it, and the memory is
+     * freed when the last one detaches.
+     * @param name The name of the segment.
+     * @return True if the segment existed.
+     */
+    static bool removeShared(const std::string &name);
 
 };
 
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::HashMap(const uint32_t &theSize)
+    : table{new Entry[theSize]}, size{theSize}, segment{} {};
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::HashMap(const HashMap &other)
+    : table{new Entry[other.size]}, size{other.size}, segment{} {
+        for (uint32_t idx = 0; idx < size; idx++) {
+            table[idx] = other.load(idx);
+        }
+    }
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::HashMap(HashMap &&other)
+    : table{other.table}, size{other.size}, segment{other.segment} {
+        other.table = nullptr;
+        other.size = 0;
+        other.segment = SharedSegment{};
+    }
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+HashMap<Key, Entry, IndexPolicy, ReplacePolicy> &HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::operator=(
+    HashMap other) {
+    std::swap(table, other.table);
+    std::swap(size, other.size);
+    std::swap(segment, other.segment);
+    return *this;
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::~HashMap() {
+    release();
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+void HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::release() {
+    if (segment.mapping != nullptr) segment.close();
+    else delete[] table;
+    table = nullptr;
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+void HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::put(const Key &key, const Value &value) {
+    uint32_t idx = IndexPolicy::calculateIndex(key, size);
+    const Entry entry{key, value};
+    if (ReplacePolicy::shouldReplace(load(idx), entry)) {
+        store(idx, entry);
+    }
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+typename Entry::Value HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::get(const Key &key) const {
+    uint32_t idx = IndexPolicy::calculateIndex(key, size);
+    const auto entry{load(idx)};
+    if (entry.matches(key)) {
+        return entry.getValue();
+    }
+    return EMPTY;
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+void HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::clear() {
+    for (uint32_t idx = 0; idx < size; idx++) {
+        store(idx, Entry());
+    }
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+bool HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::attachShared(const std::string &name) {
+    auto shared{SharedSegment::open(name, sizeof(Entry), size)};
+    if (shared.mapping == nullptr) return false;
+
+    const auto entries{static_cast<Entry *>(shared.entries)};
+    if (shared.created) {
+        for (uint32_t idx = 0; idx < shared.size; idx++) {
+            entries[idx] = Entry();
+        }
+        shared.publish();
+    }
+
+    release();
+    segment = shared;
+    table = entries;
+    size = shared.size;
+    return true;
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+bool HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::isShared() const {
+    return segment.mapping != nullptr;
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+uint32_t HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::getSize() const {
+    return size;
+}
+
+template <typename Key, typename Entry, typename IndexPolicy, typename ReplacePolicy>
+bool HashMap<Key, Entry, IndexPolicy, ReplacePolicy>::removeShared(const std::string &name) {
+    return SharedSegment::remove(name);
+}
+
 #endif
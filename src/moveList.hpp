@@ -0,0 +1,81 @@
+#ifndef MOVELIST_HPP
+#define MOVELIST_HPP
+
+#include "general.hpp"
+
+/**
+ * @class MoveList
+ * A fixed-capacity list of moves, sorted by decreasing score.
+ * The board has 9 columns, so the list never needs more than 9 moves and it can live on the stack of the search
+ * instead of the heap. Moves with the same score keep their insertion order.
+ */
+class MoveList {
+private:
+    static constexpr int CAPACITY{9}; // Maximum number of moves (one per column)
+
+    int moves[CAPACITY]; // The columns of the moves
+    int scores[CAPACITY]; // The scores of the moves
+    int moves_num; // Number of moves in the list
+
+public:
+    /**
+     * @brief Constructor.
+     * Initializes an empty list.
+     */
+    MoveList()
+        : moves_num(0) {};
+
+    /**
+     * @brief Insert a move, keeping the list sorted by decreasing score.
+     * @param column The column of the move.
+     * @param score The score of the move.
+     */
+    void add(const int &column, const int &score) {
+        #ifdef DEBUG
+        assertLogic(moves_num < CAPACITY, "The move list is full.");
+        #endif
+
+        auto idx{moves_num++};
+        for (; idx > 0 && scores[idx - 1] < score; idx--) {
+            moves[idx] = moves[idx - 1];
+            scores[idx] = scores[idx - 1];
+        }
+        moves[idx] = column;
+        scores[idx] = score;
+    }
+
+    /**
+     * @brief Get the number of moves in the list.
+     * @return The number of moves.
+     */
+    int size() const {return moves_num;}
+
+    /**
+     * @brief Get the move at the specified index.
+     * @param idx The index of the move.
+     * @return The column of the move.
+     */
+    int operator[](const int &idx) const {return moves[idx];}
+
+    /**
+     * @brief Get the score of the move at the specified index.
+     * @param idx The index of the move.
+     * @return The score of the move.
+     */
+    int getScore(const int &idx) const {return scores[idx];}
+
+    /**
+     * @brief Get an iterator to the first move.
+     * @return A pointer to the first move.
+     */
+    const int *begin() const {return moves;}
+
+    /**
+     * @brief Get an iterator past the last move.
+     * @return A pointer past the last move.
+     */
+    const int *end() const {return moves + moves_num;}
+
+};
+
+#endif
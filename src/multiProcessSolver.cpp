@@ -0,0 +1,205 @@
+#include "multiProcessSolver.hpp"
+#include "general.hpp"
+#include "solver.hpp"
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <vector>
+
+constexpr auto COLS_NUM{9}; // Number of columns
+constexpr int PENDING{0}; // State of a subtree waiting for a worker
+constexpr int SOLVED{-1}; // State of a solved subtree
+constexpr int FAILED{-2}; // State of a subtree whose workers crashed too many times
+// The state of a subtree being solved is the process id of its worker
+
+/**
+ * @brief A subtree in the memory shared by the coordinator and the workers.
+ */
+struct SubtreeSlot {
+    std::atomic<int> state{PENDING}; // Pending, solved, failed or the process id of the worker
+    int attempts{0}; // Number of workers that crashed on the subtree, written by the coordinator
+    int score{0}; // Score of the subtree, written by the worker before it is marked as solved
+    uint64_t nodes{0ULL}; // Number of nodes explored by the worker
+};
+
+static_assert(std::atomic<int>::is_always_lock_free, "The states of the subtrees are shared between processes.");
+
+/**
+ * @brief Check if a position of the split tree is solved as a whole by a worker.
+ */
+static bool isSubtree(const Board &board, const int &depth, const int &split_depth) {
+    return depth >= split_depth || board.canWinNext() || board.getNumberOfPlays() == Solver::CELLS_NUM;
+}
+
+/**
+ * @brief List the moves from the root to every subtree, depth first and column by column.
+ */
+static void collectSubtrees(Board &board, const int &depth, const int &split_depth, std::vector<int> &moves,
+    std::vector<std::vector<int>> &subtrees) {
+    if (isSubtree(board, depth, split_depth)) {
+        subtrees.push_back(moves);
+        return;
+    }
+
+    for (int column{0}; column < COLS_NUM; column++) {
+        if (!board.isValidPosition(column)) continue;
+
+        board.playMove(column);
+        moves.push_back(column);
+        collectSubtrees(board, depth + 1, split_depth, moves, subtrees);
+        moves.pop_back();
+        board.undoLastMove();
+    }
+}
+
+/**
+ * @brief Back the scores of the subtrees up to a position of the split tree (negamax), in the order of
+ * `collectSubtrees`.
+ * @param next_subtree The index of the next subtree, moved past the subtrees below the position.
+ * @param best_move The column of the best move, set at the root.
+ * @return The score of the position.
+ */
+static int backUpScore(Board &board, const int &depth, const int &split_depth, const SubtreeSlot *slots,
+    int &next_subtree, int &best_move) {
+    if (isSubtree(board, depth, split_depth)) return slots[next_subtree++].score;
+
+    auto best{Solver::MIN_SCORE - 1};
+    for (int column{0}; column < COLS_NUM; column++) {
+        if (!board.isValidPosition(column)) continue;
+
+        board.playMove(column);
+        const auto score{-backUpScore(board, depth + 1, split_depth, slots, next_subtree, best_move)};
+        board.undoLastMove();
+        if (score > best) {
+            best = score;
+            if (depth == 0) best_move = column;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Solve the pending subtrees until there are none left, then exit the worker process.
+ */
+[[noreturn]] static void runWorker(const Board &root, const std::vector<std::vector<int>> &subtrees, SubtreeSlot *slots,
+    const MultiProcessSettings &settings) {
+    // The table takes the size of the segment created by the coordinator
+    Solver solver{1};
+    if (!solver.attachSharedTable(settings.table_name)) _exit(2);
+
+    for (auto found{true}; found;) {
+        found = false;
+        for (size_t idx{0}; idx < subtrees.size(); idx++) {
+            auto expected{PENDING};
+            if (!slots[idx].state.compare_exchange_strong(expected, (int)getpid())) continue;
+            found = true;
+
+            if (settings.on_subtree) settings.on_subtree((int)idx, slots[idx].attempts);
+
+            auto board{root};
+            for (const auto column : subtrees[idx]) board.playMove(column);
+            const auto start{solver.getNodeCount()};
+            slots[idx].score = solver.solve(board);
+            slots[idx].nodes = solver.getNodeCount() - start;
+            slots[idx].state.store(SOLVED, std::memory_order_release);
+        }
+    }
+
+    _exit(0);
+}
+
+MultiProcessResult solveMultiProcess(const Board &board, const MultiProcessSettings &settings) {
+    #ifdef DEBUG
+    assertLogic(!board.checkLastPlayerWin() && !board.checkFinishDraw(), "The multi-process solve needs a game that is not over.");
+    assertLogic(settings.workers > 0, "The multi-process solve needs at least one worker.");
+    #endif
+
+    MultiProcessResult result;
+
+    // The coordinator creates the shared table, so every worker finds it with the same size
+    Solver::TranspositionTable table{settings.table_size};
+    if (!table.attachShared(settings.table_name)) return result;
+
+    auto root{board};
+    std::vector<int> moves;
+    std::vector<std::vector<int>> subtrees;
+    collectSubtrees(root, 0, settings.split_depth, moves, subtrees);
+    result.subtrees = (int)subtrees.size();
+
+    const auto bytes{subtrees.size() * sizeof(SubtreeSlot)};
+    const auto mapping{mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0)};
+    if (mapping == MAP_FAILED) {
+        if (!settings.keep_table) Solver::TranspositionTable::removeShared(settings.table_name);
+        return result;
+    }
+    const auto slots{static_cast<SubtreeSlot *>(mapping)};
+    for (size_t idx{0}; idx < subtrees.size(); idx++) new (&slots[idx]) SubtreeSlot;
+
+    // The buffered output would be written again by every worker
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    std::vector<pid_t> workers;
+    auto spawns_left{settings.workers + (int)subtrees.size() * settings.max_attempts};
+    const auto spawn{[&]() {
+        spawns_left--;
+        const auto pid{fork()};
+        if (pid == 0) runWorker(board, subtrees, slots, settings);
+        if (pid > 0) workers.push_back(pid);
+    }};
+    for (int idx{0}; idx < settings.workers && idx < result.subtrees; idx++) spawn();
+
+    while (!workers.empty()) {
+        auto reaped{false};
+        std::vector<pid_t> crashed;
+        for (auto worker{workers.begin()}; worker != workers.end();) {
+            int status;
+            if (waitpid(*worker, &status, WNOHANG) != *worker) {
+                worker++;
+                continue;
+            }
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) crashed.push_back(*worker);
+            worker = workers.erase(worker);
+            reaped = true;
+        }
+        if (!reaped) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            continue;
+        }
+
+        // Hand the subtrees of the crashed workers out again, to new workers if the others already left
+        for (const auto pid : crashed) {
+            result.crashes++;
+            for (size_t idx{0}; idx < subtrees.size(); idx++) {
+                if (slots[idx].state.load() != pid) continue;
+                slots[idx].attempts++;
+                slots[idx].state.store(slots[idx].attempts >= settings.max_attempts ? FAILED : PENDING);
+            }
+        }
+        auto pending{0};
+        for (size_t idx{0}; idx < subtrees.size(); idx++) pending += slots[idx].state.load() == PENDING ? 1 : 0;
+        while ((int)workers.size() < std::min(settings.workers, pending) && spawns_left > 0) spawn();
+    }
+
+    result.solved = true;
+    for (size_t idx{0}; idx < subtrees.size(); idx++) {
+        result.solved = result.solved && slots[idx].state.load(std::memory_order_acquire) == SOLVED;
+        result.nodes += slots[idx].nodes;
+    }
+    if (result.solved) {
+        auto next_subtree{0};
+        result.score = backUpScore(root, 0, settings.split_depth, slots, next_subtree, result.best_move);
+        if (result.best_move < 0 && root.canWinNext()) result.best_move = __builtin_ctz(root.getWinningPositions());
+    }
+
+    munmap(mapping, bytes);
+    if (!settings.keep_table) Solver::TranspositionTable::removeShared(settings.table_name);
+    return result;
+}
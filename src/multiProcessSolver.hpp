@@ -0,0 +1,49 @@
+#ifndef MULTIPROCESSSOLVER_HPP
+#define MULTIPROCESSSOLVER_HPP
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include "board.hpp"
+
+/**
+ * @brief The settings of a solve split between worker processes.
+ */
+struct MultiProcessSettings {
+    int workers{2}; // Number of worker processes
+    int split_depth{1}; // Depth below the root of the subtrees handed out to the workers
+    uint32_t table_size{(1U << 23) - 15U}; // Size of the shared transposition table, when it is created
+    std::string table_name{"/connect4_table"}; // Name of the shared memory segment of the transposition table
+    bool keep_table{false}; // Keep the shared table after the solve, so the next solves start with its bounds
+    int max_attempts{3}; // Number of times a subtree is handed out before giving up, when its workers crash
+    std::function<void(const int &subtree, const int &attempt)> on_subtree; // Called by a worker before a subtree
+};
+
+/**
+ * @brief The result of a solve split between worker processes.
+ */
+struct MultiProcessResult {
+    bool solved{false}; // Whether every subtree was solved
+    int score{0}; // Score of the root position for the current player
+    int best_move{-1}; // Column of a best move of the root, or -1 when the root is not split and cannot win at once
+    int subtrees{0}; // Number of subtrees handed out
+    int crashes{0}; // Number of worker processes that crashed
+    uint64_t nodes{0ULL}; // Number of nodes explored by the workers
+};
+
+/**
+ * @brief Compute the exact score of a position with several worker processes that share a transposition table.
+ * The coordinator (the calling process) expands the root up to the split depth, stopping at the positions where the
+ * player to move wins at once, and the worker processes solve the leaves one after the other, taking the next free
+ * one from a list in shared memory. Their solvers share one table in POSIX shared memory (see
+ * `Solver::attachSharedTable`), so every worker cuts its search with the bounds found by the others, and the table
+ * can be kept for the next solves. The coordinator then backs the scores of the leaves up to the root.
+ * A worker that crashes loses nothing: the entries of the table are written atomically, and its subtree is handed
+ * out again to a new worker.
+ * @param board The position to solve. The game must not be over.
+ * @param settings The settings of the solve.
+ * @return The result of the solve.
+ */
+MultiProcessResult solveMultiProcess(const Board &board, const MultiProcessSettings &settings);
+
+#endif
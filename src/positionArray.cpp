@@ -0,0 +1,186 @@
+#include "positionArray.hpp"
+#include "general.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+constexpr char MAGIC[4] {'C', '4', 'P', 'A'}; // File signature
+
+/**
+ * @brief The header of a position array file.
+ */
+struct PositionArrayHeader {
+    char magic[4]; // File signature
+    uint32_t version; // File format version
+    uint64_t positions_num; // Number of records
+    uint64_t record_size; // Size of a record in bytes
+};
+
+static_assert(sizeof(PositionArrayHeader) == 24, "The header must keep the records aligned to 8 bytes.");
+
+PackedPosition packPosition(const Board &board, const int16_t &label) {
+    const auto board_bits{board.getBoard()};
+    const auto player_bits{board.getPlayerPieces()};
+
+    PackedPosition position;
+    position.board_tail = (uint64_t)board_bits;
+    position.player_tail = (uint64_t)player_bits;
+    position.board_head = (uint8_t)(uint64_t)(board_bits >> 64);
+    position.player_head = (uint8_t)(uint64_t)(player_bits >> 64);
+    position.plays = (uint8_t)board.getNumberOfPlays();
+    position.flags = board.getCurrentPlayer() ? 1 : 0;
+    position.label = label;
+    position.reserved = 0;
+    return position;
+}
+
+bool unpackPosition(const PackedPosition &position, Board &board) {
+    if ((position.flags & ~1) != 0) return false;
+
+    // The board encoding has the same layout, one byte per column
+    uint8_t buffer[Board::SERIALIZED_SIZE];
+    buffer[0] = Board::SERIALIZATION_VERSION;
+    buffer[1] = position.flags & 1;
+    buffer[2] = position.plays;
+    for (int column{0}; column < 8; column++) {
+        buffer[3 + column] = (uint8_t)(position.board_tail >> (8 * column));
+        buffer[12 + column] = (uint8_t)(position.player_tail >> (8 * column));
+    }
+    buffer[11] = position.board_head;
+    buffer[20] = position.player_head;
+
+    return Board::deserialize(buffer, Board::SERIALIZED_SIZE, board) != 0;
+}
+
+/**
+ * @brief Reverse the column order of a bitboard split in 64 + 8 bits.
+ * @param tail The columns 0 to 7, 8 bits per column.
+ * @param head The column 8.
+ * @param mirrored_tail The mirrored columns 0 to 7.
+ * @param mirrored_head The mirrored column 8.
+ */
+static void mirrorBitboard(const uint64_t &tail, const uint8_t &head, uint64_t &mirrored_tail, uint8_t &mirrored_head) {
+    // The column 8 goes to the column 0 and the columns 0 to 7 are shifted one column up, in reverse order
+    mirrored_head = (uint8_t)tail;
+    mirrored_tail = (uint64_t)head | (__builtin_bswap64(tail) << 8);
+}
+
+PackedPosition mirrorPosition(const PackedPosition &position) {
+    auto mirrored{position};
+    mirrorBitboard(position.board_tail, position.board_head, mirrored.board_tail, mirrored.board_head);
+    mirrorBitboard(position.player_tail, position.player_head, mirrored.player_tail, mirrored.player_head);
+    return mirrored;
+}
+
+bool comparePositions(const PackedPosition &lhs, const PackedPosition &rhs) {
+    if (lhs.board_head != rhs.board_head) return lhs.board_head < rhs.board_head;
+    if (lhs.board_tail != rhs.board_tail) return lhs.board_tail < rhs.board_tail;
+    if (lhs.player_head != rhs.player_head) return lhs.player_head < rhs.player_head;
+    return lhs.player_tail < rhs.player_tail;
+}
+
+PositionArray::PositionArray()
+    : data(nullptr), size(0), positions(nullptr), positions_num(0ULL) {};
+
+PositionArray::~PositionArray() {
+    close();
+}
+
+bool PositionArray::open(const std::string &path) {
+    close();
+
+    const auto file{::open(path.c_str(), O_RDONLY)};
+    if (file < 0) return false;
+
+    struct stat status;
+    if (fstat(file, &status) != 0 || (size_t)status.st_size < sizeof(PositionArrayHeader)) {
+        ::close(file);
+        return false;
+    }
+
+    void *memory = mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if (memory == MAP_FAILED) return false;
+
+    data = static_cast<const char *>(memory);
+    size = status.st_size;
+
+    // Check the header before exposing the records
+    const auto header{reinterpret_cast<const PositionArrayHeader *>(data)};
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION ||
+        header->record_size != sizeof(PackedPosition) ||
+        header->positions_num > (size - sizeof(PositionArrayHeader)) / sizeof(PackedPosition)) {
+        close();
+        return false;
+    }
+
+    positions = reinterpret_cast<const PackedPosition *>(data + sizeof(PositionArrayHeader));
+    positions_num = header->positions_num;
+    return true;
+}
+
+void PositionArray::close() {
+    if (data != nullptr) munmap((void *)data, size);
+    data = nullptr;
+    size = 0;
+    positions = nullptr;
+    positions_num = 0ULL;
+}
+
+uint64_t PositionArray::getSize() const {
+    return positions_num;
+}
+
+const PackedPosition &PositionArray::operator[](const uint64_t &idx) const {
+    #ifdef DEBUG
+    assertError(idx < positions_num, "Invalid position index. The index exceeds the number of positions.");
+    #endif
+
+    return positions[idx];
+}
+
+const PackedPosition *PositionArray::find(const PackedPosition &position) const {
+    const auto found{std::lower_bound(begin(), end(), position, comparePositions)};
+    if (found == end() || comparePositions(position, *found)) return nullptr;
+    return found;
+}
+
+const PackedPosition *PositionArray::begin() const {
+    return positions;
+}
+
+const PackedPosition *PositionArray::end() const {
+    return positions + positions_num;
+}
+
+PositionArrayWriter::PositionArrayWriter()
+    : positions_num(0ULL) {};
+
+bool PositionArrayWriter::open(const std::string &path) {
+    file.open(path, std::ios::binary | std::ios::trunc);
+    positions_num = 0ULL;
+    if (!file.is_open()) return false;
+
+    // The number of records is written again when the file is closed
+    PositionArrayHeader header{{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]}, PositionArray::VERSION, 0ULL, sizeof(PackedPosition)};
+    file.write((const char *)&header, sizeof(header));
+    return file.good();
+}
+
+void PositionArrayWriter::add(const PackedPosition &position) {
+    file.write((const char *)&position, sizeof(position));
+    positions_num++;
+}
+
+bool PositionArrayWriter::close() {
+    if (!file.is_open()) return false;
+
+    file.seekp(offsetof(PositionArrayHeader, positions_num));
+    file.write((const char *)&positions_num, sizeof(positions_num));
+    const auto written{file.good()};
+    file.close();
+    return written;
+}
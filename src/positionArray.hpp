@@ -0,0 +1,176 @@
+#ifndef POSITIONARRAY_HPP
+#define POSITIONARRAY_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <fstream>
+#include <string>
+#include "board.hpp"
+
+/**
+ * @brief A position packed in a fixed-size record of 24 bytes.
+ * The bitboards are split in the 64 bits of the columns 0 to 7 and the 8 bits of the column 8. The label is free for
+ * the users of the format (a score, a game result, ...).
+ */
+struct PackedPosition {
+    uint64_t board_tail; // Columns 0 to 7 of the board
+    uint64_t player_tail; // Columns 0 to 7 of the current player's pieces
+    uint8_t board_head; // Column 8 of the board
+    uint8_t player_head; // Column 8 of the current player's pieces
+    uint8_t plays; // Number of plays
+    uint8_t flags; // Bit 0: the current player
+    int16_t label; // Free label of the position
+    uint16_t reserved; // Padding, always zero
+};
+
+static_assert(sizeof(PackedPosition) == 24, "PackedPosition must have a fixed size of 24 bytes.");
+
+/**
+ * @brief Pack a position.
+ * @param board The position to pack. Its play history is not stored.
+ * @param label The label of the position. Default value is 0.
+ * @return The packed position.
+ */
+PackedPosition packPosition(const Board &board, const int16_t &label = 0);
+
+/**
+ * @brief Unpack a position. The board is rebuilt without play history.
+ * The record goes through the checks of `Board::deserialize`, since it may come from a corrupt file.
+ * @param position The packed position.
+ * @param board The position. It is only modified if the record is a valid position.
+ * @return True if the record is a valid position, false otherwise.
+ */
+bool unpackPosition(const PackedPosition &position, Board &board);
+
+/**
+ * @brief Mirror a packed position (the column 0 becomes the column 8 and so on).
+ * @param position The packed position.
+ * @return The mirrored position, with the same number of plays, flags and label.
+ */
+PackedPosition mirrorPosition(const PackedPosition &position);
+
+/**
+ * @brief Order the packed positions by their bitboards, ignoring the plays, the flags and the label.
+ * @param lhs The first position.
+ * @param rhs The second position.
+ * @return True if the first position goes before the second one, false otherwise.
+ */
+bool comparePositions(const PackedPosition &lhs, const PackedPosition &rhs);
+
+/**
+ * @class PositionArray
+ * A read-only array of packed positions, memory mapped from a file.
+ * The file is a 24-byte header (signature, version, number of records and record size) followed by the records, in
+ * the native byte order (little endian on all the supported platforms). The records are read in place from the
+ * mapping, with no parsing and no copy, so big datasets, books and batch inputs open instantly and only the touched
+ * pages are loaded.
+ */
+class PositionArray {
+private:
+    const char *data; // The mapped file
+    size_t size; // Size of the mapped file in bytes
+    const PackedPosition *positions; // The first record
+    uint64_t positions_num; // Number of records
+
+public:
+    static constexpr uint32_t VERSION{1}; // File format version
+
+    /**
+     * @brief Constructor.
+     * Initializes an empty array.
+     */
+    PositionArray();
+
+    PositionArray(const PositionArray &other) = delete;
+    PositionArray &operator=(const PositionArray &other) = delete;
+
+    /**
+     * @brief Destructor for the PositionArray class.
+     */
+    ~PositionArray();
+
+    /**
+     * @brief Map a position array file.
+     * @param path The path of the file.
+     * @return True if the file was mapped and has a valid header, false otherwise.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Unmap the current file.
+     */
+    void close();
+
+    /**
+     * @brief Get the number of positions.
+     * @return The number of positions.
+     */
+    uint64_t getSize() const;
+
+    /**
+     * @brief Get the position at the specified index, in place.
+     * @param idx The index of the position.
+     * @return A reference to the record in the mapping.
+     */
+    const PackedPosition &operator[](const uint64_t &idx) const;
+
+    /**
+     * @brief Find a position with a binary search.
+     * The array must be sorted with `comparePositions`, as the opening books are.
+     * @param position The position to find. Only its bitboards are compared.
+     * @return A pointer to the record in the mapping, or null if the position is not in the array.
+     */
+    const PackedPosition *find(const PackedPosition &position) const;
+
+    /**
+     * @brief Get an iterator to the first position.
+     * @return A pointer to the first record.
+     */
+    const PackedPosition *begin() const;
+
+    /**
+     * @brief Get an iterator past the last position.
+     * @return A pointer past the last record.
+     */
+    const PackedPosition *end() const;
+
+};
+
+/**
+ * @class PositionArrayWriter
+ * Writes a position array file, one position at a time.
+ */
+class PositionArrayWriter {
+private:
+    std::ofstream file; // The output file
+    uint64_t positions_num; // Number of written positions
+
+public:
+    /**
+     * @brief Constructor.
+     * Initializes a writer without any file.
+     */
+    PositionArrayWriter();
+
+    /**
+     * @brief Create a position array file.
+     * @param path The path of the file.
+     * @return True if the file was created, false otherwise.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Append a position to the file.
+     * @param position The packed position.
+     */
+    void add(const PackedPosition &position);
+
+    /**
+     * @brief Write the final header and close the file.
+     * @return True if the whole file was written, false otherwise.
+     */
+    bool close();
+
+};
+
+#endif
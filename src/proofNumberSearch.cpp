@@ -0,0 +1,241 @@
+#include "proofNumberSearch.hpp"
+#include "general.hpp"
+#include <algorithm>
+
+constexpr auto COLS_NUM{9}; // Number of columns
+constexpr auto CELLS_NUM{63}; // Number of playable cells of the board
+constexpr uint64_t ODD_ATTACKER_SALT{0xD6E8FEB86659FD93ULL}; // Key salt of the searches whose attacker plays on odd plays
+
+ProofNumberSearch::ProofNumberSearch(const uint64_t &theMemoryBudget)
+    : entries_num(std::max<uint64_t>(2ULL, theMemoryBudget / sizeof(Entry)) & ~1ULL), arena(entries_num * sizeof(Entry)),
+    table(nullptr), node_count(0ULL), node_limit(0ULL), attacker_salt(0ULL), has_deadline(false), stop_flag(nullptr),
+    stopped(false), proving_move(-1) {
+    // Expand the columns from the center to the borders
+    for (int idx{0}; idx < COLS_NUM; idx++) {
+        column_order[idx] = COLS_NUM / 2 + (1 - 2 * (idx % 2)) * (idx + 1) / 2;
+    }
+}
+
+uint64_t ProofNumberSearch::calculateKey(const Board &board) const {
+    return board.getHash() ^ attacker_salt;
+}
+
+/**
+ * @brief Check if an entry of the node table is empty (no node has both numbers equal to zero).
+ */
+static bool isEmpty(const uint32_t &phi, const uint32_t &delta) {
+    return phi == 0 && delta == 0;
+}
+
+const ProofNumberSearch::Entry *ProofNumberSearch::lookup(const uint64_t &key) const {
+    const auto bucket{&table[(key % (entries_num / 2)) * 2]};
+    for (int slot{0}; slot < 2; slot++) {
+        if (bucket[slot].key == key && !isEmpty(bucket[slot].phi, bucket[slot].delta)) return &bucket[slot];
+    }
+    return nullptr;
+}
+
+void ProofNumberSearch::store(const uint64_t &key, const uint32_t &phi, const uint32_t &delta, const uint64_t &work) {
+    const auto bucket{&table[(key % (entries_num / 2)) * 2]};
+
+    // Keep the solved entries first, then the biggest subtrees
+    const auto priority{[](const Entry &entry) {
+        if (isEmpty(entry.phi, entry.delta)) return 0ULL;
+        if (entry.phi == 0 || entry.delta == 0) return ~0ULL;
+        return entry.work + 1ULL;
+    }};
+
+    auto target{&bucket[0]};
+    if (bucket[1].key == key || (bucket[0].key != key && priority(bucket[1]) < priority(bucket[0]))) target = &bucket[1];
+    *target = Entry{key, phi, delta, work};
+}
+
+void ProofNumberSearch::evaluate(Board &board, uint32_t &phi, uint32_t &delta) {
+    const auto entry{lookup(calculateKey(board))};
+    if (entry != nullptr) {
+        phi = entry->phi;
+        delta = entry->delta;
+        return;
+    }
+
+    // The player to move wins at once
+    if (board.canWinNext()) {
+        phi = 0;
+        delta = INFINITE;
+        return;
+    }
+
+    // Every move lets the opponent win with the next move
+    const auto next{board.getNonLosingPositions()};
+    if (next == 0) {
+        phi = INFINITE;
+        delta = 0;
+        return;
+    }
+
+    // Only two cells left and neither player can win with them: the draw is a failure of the attacker
+    const auto plays{board.getNumberOfPlays()};
+    if (plays >= CELLS_NUM - 2) {
+        const auto attacker_to_move{((plays & 1) != 0) == (attacker_salt != 0ULL)};
+        phi = attacker_to_move ? INFINITE : 0;
+        delta = attacker_to_move ? 0 : INFINITE;
+        return;
+    }
+
+    // One proof is enough, every move has to be disproved
+    phi = 1;
+    delta = __builtin_popcount(next);
+}
+
+void ProofNumberSearch::expand(Board &board, const uint32_t &threshold_phi, const uint32_t &threshold_delta,
+    uint32_t &phi, uint32_t &delta) {
+    const auto key{calculateKey(board)};
+
+    // Another path may have already pushed the numbers of the position past the thresholds
+    const auto entry{lookup(key)};
+    if (entry != nullptr && (entry->phi >= threshold_phi || entry->delta >= threshold_delta)) {
+        phi = entry->phi;
+        delta = entry->delta;
+        return;
+    }
+
+    const auto start{node_count++};
+
+    // Check the clock and the stop flag
+    if ((node_count & 1023ULL) == 0ULL) {
+        if (has_deadline && std::chrono::steady_clock::now() >= deadline) stopped = true;
+        if (stop_flag != nullptr && stop_flag->load(std::memory_order_relaxed)) stopped = true;
+    }
+
+    // The moves that do not let the opponent win at once
+    const auto next{board.getNonLosingPositions()};
+    int columns[COLS_NUM];
+    uint32_t children_phi[COLS_NUM], children_delta[COLS_NUM];
+    auto children_num{0};
+    for (const auto column : column_order) {
+        if ((next & (1 << column)) == 0) continue;
+
+        board.playMove(column);
+        evaluate(board, children_phi[children_num], children_delta[children_num]);
+        board.undoLastMove();
+        columns[children_num++] = column;
+    }
+
+    while (true) {
+        // The goal of the player to move is reached by one child, where the opponent fails, and lost if it is lost by
+        // all of them
+        phi = INFINITE;
+        delta = 0;
+        auto second{INFINITE};
+        auto best{0};
+        for (int child{0}; child < children_num; child++) {
+            if (children_delta[child] < phi) {
+                second = phi;
+                phi = children_delta[child];
+                best = child;
+            } else if (children_delta[child] < second) {
+                second = children_delta[child];
+            }
+            delta = std::min(INFINITE, delta + children_phi[child]);
+        }
+
+        if (phi == 0) proving_move = columns[best];
+        if (phi >= threshold_phi || delta >= threshold_delta || node_count >= node_limit || stopped) break;
+
+        // Search the most proving child until it is no longer the most proving one, with a 25% margin over the second
+        // best child (1 + epsilon trick) so the search does not keep switching between two children
+        const auto child_threshold_phi{std::min(INFINITE, threshold_delta - (delta - children_phi[best]))};
+        const auto child_threshold_delta{std::min(threshold_phi, std::max(second + 1, second + second / 4))};
+        board.playMove(columns[best]);
+        expand(board, child_threshold_phi, child_threshold_delta, children_phi[best], children_delta[best]);
+        board.undoLastMove();
+    }
+
+    store(key, phi, delta, node_count - start);
+}
+
+int ProofNumberSearch::findProvingMove(Board &board, const bool &research) {
+    const auto next{board.getNonLosingPositions()};
+    for (const auto column : column_order) {
+        if ((next & (1 << column)) == 0) continue;
+
+        uint32_t child_phi, child_delta;
+        board.playMove(column);
+        evaluate(board, child_phi, child_delta);
+        if (research && child_phi != 0 && child_delta != 0) expand(board, INFINITE, INFINITE, child_phi, child_delta);
+        board.undoLastMove();
+
+        if (child_delta == 0) return column;
+        if (node_count >= node_limit || stopped) break;
+    }
+    return -1;
+}
+
+ProofNumberSearch::Result ProofNumberSearch::search(Board &board, const uint64_t &nodeLimit) {
+    #ifdef DEBUG
+    assertLogic(!board.checkLastPlayerWin() && !board.checkFinishDraw(), "The proof-number search needs a game that is not over.");
+    #endif
+
+    if (table == nullptr) {
+        table = arena.allocateArray<Entry>(entries_num);
+        std::fill(table, table + entries_num, Entry{0ULL, 0, 0, 0ULL});
+    }
+
+    proving_move = -1;
+    stopped = false;
+    attacker_salt = (board.getNumberOfPlays() & 1) != 0 ? ODD_ATTACKER_SALT : 0ULL;
+    node_limit = node_count + nodeLimit;
+
+    // The attacker wins at once
+    const auto winning{board.getWinningPositions()};
+    if (winning != 0) {
+        proving_move = __builtin_ctz(winning);
+        return PROVEN;
+    }
+
+    uint32_t phi, delta;
+    evaluate(board, phi, delta);
+    if (phi != 0 && delta != 0) expand(board, INFINITE, INFINITE, phi, delta);
+
+    if (phi != 0) {
+        proving_move = -1;
+        return delta == 0 ? DISPROVEN : UNKNOWN;
+    }
+
+    // The root was proved by a previous search, the winning move leads to a disproved child
+    if (proving_move < 0) proving_move = findProvingMove(board, false);
+
+    // The entry of the disproved child was replaced since, the children are searched again
+    if (proving_move < 0) proving_move = findProvingMove(board, true);
+
+    return proving_move < 0 ? UNKNOWN : PROVEN;
+}
+
+void ProofNumberSearch::setDeadline(const std::chrono::steady_clock::time_point &theDeadline) {
+    deadline = theDeadline;
+    has_deadline = true;
+}
+
+void ProofNumberSearch::clearDeadline() {
+    has_deadline = false;
+}
+
+void ProofNumberSearch::setStopFlag(const std::atomic<bool> *theFlag) {
+    stop_flag = theFlag;
+}
+
+int ProofNumberSearch::getProvingMove() const {
+    return proving_move;
+}
+
+uint64_t ProofNumberSearch::getNodeCount() const {
+    return node_count;
+}
+
+void ProofNumberSearch::reset() {
+    node_count = 0ULL;
+
+    // The next search allocates a cleared table again
+    arena.reset();
+    table = nullptr;
+}
@@ -0,0 +1,167 @@
+#ifndef PROOFNUMBERSEARCH_HPP
+#define PROOFNUMBERSEARCH_HPP
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include "arena.hpp"
+#include "board.hpp"
+
+/**
+ * @class ProofNumberSearch
+ * A depth-first proof-number search (df-pn) that proves or disproves that the current player can force a win.
+ * Every node has a proof number and a disproof number: the number of leaves that still have to be solved to prove or
+ * to disprove it. The search always expands the most proving node, with thresholds that keep it in a subtree as long
+ * as it stays the most proving one, so it only needs a transposition table and no explicit tree. It goes deep fast in
+ * sharp positions with long forced sequences, where alpha-beta has to search every reply.
+ * The moves come from the threat masks of the board: a node where the player to move can win at once is solved, and
+ * only the moves that do not give the opponent an immediate win are expanded (a single one when the opponent has a
+ * threat to block). The initial disproof number of a new node is its number of such moves.
+ * A draw counts as a failure of the attacker (the player to move at the root), so a disproved position is a draw or a
+ * loss. The node table has a fixed memory budget, split in buckets of two entries. A new entry replaces the one of its
+ * bucket with the smallest explored subtree, solved entries being kept first.
+ */
+class ProofNumberSearch {
+private:
+    /**
+     * @brief An entry of the node table, with the numbers seen by the player to move of the node.
+     */
+    struct Entry {
+        uint64_t key; // The key of the position
+        uint32_t phi; // Proof number of the goal of the player to move (0 once it is reached)
+        uint32_t delta; // Disproof number of the goal of the player to move (0 once it is out of reach)
+        uint64_t work; // Number of nodes explored below the position, used by the replacement
+    };
+
+    uint64_t entries_num; // Number of entries of the node table, an even number
+    Arena arena; // Memory block of the node table, of the size of the memory budget
+    Entry *table; // Node table, allocated from the arena by the first search after a reset
+    uint64_t node_count; // Number of nodes expanded since the last reset
+    uint64_t node_limit; // Node count at which the current search stops
+    uint64_t attacker_salt; // Added to the keys when the attacker plays on odd plays
+    std::chrono::steady_clock::time_point deadline; // Time at which the search is stopped
+    bool has_deadline; // Whether the deadline is set
+    const std::atomic<bool> *stop_flag; // Flag that stops the search when it is raised, or null
+    bool stopped; // Whether the current search was stopped by the deadline or the stop flag
+    int column_order[9]; // Order in which the columns are expanded (center first)
+    int proving_move; // Winning move of the last proved root, or -1
+
+    /**
+     * @brief Get the key of a position in the node table.
+     * The numbers of a node depend on the side of the attacker, so the key includes it.
+     * @param board The position.
+     * @return The key.
+     */
+    uint64_t calculateKey(const Board &board) const;
+
+    /**
+     * @brief Look for a position in the node table.
+     * @param key The key of the position.
+     * @return The entry of the position, or null if it is not in the table.
+     */
+    const Entry *lookup(const uint64_t &key) const;
+
+    /**
+     * @brief Store the numbers of a position, replacing the entry with the smallest subtree of its bucket.
+     * @param key The key of the position.
+     * @param phi The proof number.
+     * @param delta The disproof number.
+     * @param work The number of nodes explored below the position.
+     */
+    void store(const uint64_t &key, const uint32_t &phi, const uint32_t &delta, const uint64_t &work);
+
+    /**
+     * @brief Get the numbers of a position, from the node table or from its threat masks if it was never expanded.
+     * @param board The position.
+     * @param phi The proof number.
+     * @param delta The disproof number.
+     */
+    void evaluate(Board &board, uint32_t &phi, uint32_t &delta);
+
+    /**
+     * @brief Expand a position until one of its numbers reaches its threshold (multiple iterative deepening).
+     * The position must not be solved by its threat masks.
+     * @param board The position. It is restored before returning.
+     * @param threshold_phi The threshold of the proof number.
+     * @param threshold_delta The threshold of the disproof number.
+     * @param phi The final proof number.
+     * @param delta The final disproof number.
+     */
+    void expand(Board &board, const uint32_t &threshold_phi, const uint32_t &threshold_delta, uint32_t &phi,
+        uint32_t &delta);
+
+    /**
+     * @brief Find the winning move of a proved position, a move to a disproved child.
+     * @param board The proved position. It is restored before returning.
+     * @param research Whether the children without a solved entry are searched again, within the node limit.
+     * @return The column of the winning move, or -1 if no child is known to be disproved.
+     */
+    int findProvingMove(Board &board, const bool &research);
+
+public:
+    /**
+     * @brief The result of a search.
+     */
+    enum Result {
+        DISPROVEN, // The attacker cannot force a win
+        PROVEN, // The attacker can force a win
+        UNKNOWN // The node limit, the deadline or the stop flag was reached first
+    };
+
+    static constexpr uint32_t INFINITE{1U << 30}; // Number of a solved node, larger than every sum of numbers
+
+    /**
+     * @brief Constructor.
+     * @param theMemoryBudget The size of the node table in bytes. Default value is 16 MiB.
+     */
+    ProofNumberSearch(const uint64_t &theMemoryBudget = 1ULL << 24);
+
+    /**
+     * @brief Prove or disprove that the current player can force a win.
+     * The node table is kept between the searches, so a search can go on from where a previous one stopped.
+     * @param board The position. It is restored before returning.
+     * @param nodeLimit The maximum number of nodes to expand.
+     * @return The result of the search.
+     */
+    Result search(Board &board, const uint64_t &nodeLimit);
+
+    /**
+     * @brief Set a deadline for the next searches.
+     * The clock is checked every 1024 nodes. When the deadline is over, the search stops as if it reached its node
+     * limit and returns UNKNOWN.
+     * @param theDeadline The time at which the searches are stopped.
+     */
+    void setDeadline(const std::chrono::steady_clock::time_point &theDeadline);
+
+    /**
+     * @brief Remove the deadline of the searches.
+     */
+    void clearDeadline();
+
+    /**
+     * @brief Set a flag that stops the searches when another thread raises it.
+     * The flag is checked every 1024 nodes, like the deadline.
+     * @param theFlag The stop flag, or null to remove it. It must outlive the searches.
+     */
+    void setStopFlag(const std::atomic<bool> *theFlag);
+
+    /**
+     * @brief Get a winning move of the last search.
+     * @return The column of the winning move if the last search proved the position, otherwise -1.
+     */
+    int getProvingMove() const;
+
+    /**
+     * @brief Get the number of nodes expanded since the last reset.
+     * @return The number of expanded nodes.
+     */
+    uint64_t getNodeCount() const;
+
+    /**
+     * @brief Reset the node counter and clear the node table.
+     */
+    void reset();
+
+};
+
+#endif
@@ -0,0 +1,397 @@
+#include "solver.hpp"
+#include "arena.hpp"
+#include "general.hpp"
+#include "moveList.hpp"
+#include <algorithm>
+
+constexpr auto COLS_NUM{9}; // Number of columns
+
+/**
+ * @brief The outcomes stored in the entries of the weak solve table (0 is an empty entry).
+ */
+enum WeakOutcome : uint8_t {
+    WEAK_LOSS = 1, // The current player loses
+    WEAK_NOT_WIN = 2, // The current player draws or loses
+    WEAK_WIN = 3 // The current player wins
+};
+
+Solver::Solver(const uint32_t &theTableSize)
+    : table(theTableSize), table_size(theTableSize), node_count(0ULL), endgame_database(nullptr), probe_endgame(false), has_deadline(false),
+      stop_flag(nullptr), stopped(false), root_plays(0), max_depth(0) {
+    // Explore the columns from the center to the borders
+    for (int idx{0}; idx < COLS_NUM; idx++) {
+        column_order[idx] = COLS_NUM / 2 + (1 - 2 * (idx % 2)) * (idx + 1) / 2;
+    }
+}
+
+int Solver::negamax(Board &board, int alpha, int beta) {
+    #ifdef DEBUG
+    assertLogic(alpha < beta, "The search window of the negamax must not be empty.");
+    assertLogic(!board.canWinNext(), "The negamax must not be called when the current player can win with the next move.");
+    #endif
+
+    node_count++;
+
+    // Check the clock and the stop flag from time to time
+    if ((node_count & 1023ULL) == 0ULL) {
+        if (has_deadline && std::chrono::steady_clock::now() >= deadline) stopped = true;
+        if (stop_flag != nullptr && stop_flag->load(std::memory_order_relaxed)) stopped = true;
+    }
+    if (stopped) return alpha;
+
+    const auto plays{board.getNumberOfPlays()};
+    const auto next{board.getNonLosingPositions()};
+    const auto ply{plays - root_plays};
+    if (ply > max_depth) max_depth = ply;
+
+    // The principal variation of the node stays empty until a move gets an exact score
+    pv_length[ply] = ply;
+
+    // Every move lets the opponent win with the next move
+    if (next == 0) return -(CELLS_NUM - plays) / 2;
+
+    // Only two cells left and neither player can win with them
+    if (plays >= CELLS_NUM - 2) return 0;
+
+    // The endgame database gives the sign of the score
+    if (probe_endgame && CELLS_NUM - plays <= endgame_database->getMaxEmpty()) {
+        switch (endgame_database->probe(board)) {
+            case EndgameDatabase::DRAW:
+                return 0;
+            case EndgameDatabase::WIN:
+                if (alpha < 1) {
+                    alpha = 1;
+                    if (alpha >= beta) return alpha;
+                }
+                break;
+            case EndgameDatabase::LOSS:
+                if (beta > -1) {
+                    beta = -1;
+                    if (alpha >= beta) return beta;
+                }
+                break;
+        }
+    }
+
+    // The opponent cannot win with the next move, so the score has a lower bound
+    const auto min{-(CELLS_NUM - 2 - plays) / 2};
+    if (alpha < min) {
+        alpha = min;
+        if (alpha >= beta) return alpha;
+    }
+
+    // The current player cannot win with the next move, so the score has an upper bound
+    auto max{(CELLS_NUM - 1 - plays) / 2};
+    const auto key{board.getHash()};
+    const auto value{table.get(key)};
+    if (value != TranspositionTable::EMPTY) max = value + MIN_SCORE - 1;
+    if (beta > max) {
+        beta = max;
+        if (alpha >= beta) return beta;
+    }
+
+    // Sort the non-losing moves by their score, keeping the center first order for ties
+    MoveList moves;
+    for (const auto column : column_order) {
+        if ((next & (1 << column)) == 0) continue;
+        moves.add(column, board.getMoveScore(column));
+    }
+
+    for (const auto column : moves) {
+        board.playMove(column);
+        const auto score{-negamax(board, -beta, -alpha)};
+        board.undoLastMove();
+
+        // The score of a stopped search is meaningless
+        if (stopped) return alpha;
+
+        // Prune the exploration if a better move than the window allows was found
+        if (score >= beta) return score;
+        if (score > alpha) {
+            alpha = score;
+
+            // The score is exact, so the move and the variation of the child are the principal variation
+            pv_moves[ply][ply] = column;
+            std::copy(pv_moves[ply + 1] + ply + 1, pv_moves[ply + 1] + pv_length[ply + 1], pv_moves[ply] + ply + 1);
+            pv_length[ply] = pv_length[ply + 1];
+        }
+    }
+
+    // Store the upper bound of the position
+    table.put(key, (uint8_t)(alpha - MIN_SCORE + 1));
+    return alpha;
+}
+
+int Solver::negamaxWeak(Board &board, int alpha, int beta) {
+    #ifdef DEBUG
+    assertLogic(-1 <= alpha && alpha < beta && beta <= 1, "The search window of the weak negamax must be inside [-1, 1].");
+    assertLogic(!board.canWinNext(), "The negamax must not be called when the current player can win with the next move.");
+    #endif
+
+    node_count++;
+
+    // Check the clock and the stop flag from time to time
+    if ((node_count & 1023ULL) == 0ULL) {
+        if (has_deadline && std::chrono::steady_clock::now() >= deadline) stopped = true;
+        if (stop_flag != nullptr && stop_flag->load(std::memory_order_relaxed)) stopped = true;
+    }
+    if (stopped) return alpha;
+
+    const auto plays{board.getNumberOfPlays()};
+    const auto next{board.getNonLosingPositions()};
+    if (plays - root_plays > max_depth) max_depth = plays - root_plays;
+
+    // Every move lets the opponent win with the next move
+    if (next == 0) return -1;
+
+    // Only two cells left and neither player can win with them
+    if (plays >= CELLS_NUM - 2) return 0;
+
+    // The endgame database gives the outcome
+    if (probe_endgame && CELLS_NUM - plays <= endgame_database->getMaxEmpty()) {
+        switch (endgame_database->probe(board)) {
+            case EndgameDatabase::DRAW:
+                return 0;
+            case EndgameDatabase::WIN:
+                return 1;
+            case EndgameDatabase::LOSS:
+                return -1;
+        }
+    }
+
+    const auto hash{board.getHash()};
+    switch (wdl_table->get(hash)) {
+        case WEAK_LOSS:
+            return -1;
+        case WEAK_WIN:
+            return 1;
+        case WEAK_NOT_WIN:
+            if (beta > 0) {
+                beta = 0;
+                if (alpha >= beta) return beta;
+            }
+            break;
+    }
+
+    // Sort the non-losing moves by their score, keeping the center first order for ties
+    MoveList moves;
+    for (const auto column : column_order) {
+        if ((next & (1 << column)) == 0) continue;
+        moves.add(column, board.getMoveScore(column));
+    }
+
+    for (const auto column : moves) {
+        board.playMove(column);
+        const auto score{-negamaxWeak(board, -beta, -alpha)};
+        board.undoLastMove();
+
+        // The outcome of a stopped search is meaningless
+        if (stopped) return alpha;
+
+        // The first proof of a win ends the search
+        if (score >= beta) {
+            if (score > 0) wdl_table->put(hash, WEAK_WIN);
+            return score;
+        }
+        if (score > alpha) alpha = score;
+    }
+
+    // Store the upper bound of the outcome
+    wdl_table->put(hash, alpha < 0 ? WEAK_LOSS : WEAK_NOT_WIN);
+    return alpha;
+}
+
+void Solver::prepareSearch(const Board &board) {
+    probe_endgame = endgame_database != nullptr && endgame_database->isBelowRoot(board);
+    stopped = false;
+    root_plays = board.getNumberOfPlays();
+    max_depth = 0;
+}
+
+int Solver::solve(Board &board) {
+    const auto plays{board.getNumberOfPlays()};
+    prepareSearch(board);
+
+    if (board.canWinNext()) return (CELLS_NUM + 1 - plays) / 2;
+    if (plays == CELLS_NUM) return 0;
+
+    auto min{-(CELLS_NUM - plays) / 2};
+    auto max{(CELLS_NUM + 1 - plays) / 2};
+
+    // Bisect the score range with null-window searches
+    while (min < max) {
+        auto med{min + (max - min) / 2};
+
+        // Move the pivot towards zero, where most of the scores are
+        if (med <= 0 && min / 2 < med) med = min / 2;
+        else if (med >= 0 && max / 2 > med) med = max / 2;
+
+        // Check if the score is greater than the pivot
+        const auto score{negamax(board, med, med + 1)};
+        if (stopped) break;
+        if (score <= med) max = score;
+        else min = score;
+    }
+
+    return min;
+}
+
+int Solver::solveWeak(Board &board) {
+    prepareSearch(board);
+
+    if (board.canWinNext()) return 1;
+    if (board.getNumberOfPlays() == CELLS_NUM) return 0;
+
+    if (!wdl_table) wdl_table.reset(new WeakTable(table_size));
+    return negamaxWeak(board, -1, 1);
+}
+
+void Solver::extractPrincipalVariation(Board &board, int score, std::vector<int> &principal_variation) {
+    auto played{0};
+
+    // Moves of the variation found by each search, in the scratch memory of the thread
+    auto &arena{Arena::getThreadArena()};
+    ArenaScope scope{arena};
+    const auto moves{arena.allocateArray<int>(CELLS_NUM)};
+
+    while (!board.checkLastPlayerWin() && !board.checkFinishDraw()) {
+        // The variation ends with the winning move
+        const auto winning{board.getWinningPositions()};
+        if (winning != 0) {
+            principal_variation.push_back(__builtin_ctz(winning));
+            board.playMove(principal_variation.back());
+            played++;
+            break;
+        }
+
+        // Search the position with a window around its score to fill the triangular array
+        root_plays = board.getNumberOfPlays();
+        negamax(board, score - 1, score + 1);
+        if (stopped) break;
+        auto moves_num{pv_length[0]};
+        std::copy(pv_moves[0], pv_moves[0] + moves_num, moves);
+
+        // Walk the transposition table when the variation was cut at the root
+        if (moves_num == 0) {
+            const auto next{board.getNonLosingPositions()};
+            for (const auto column : column_order) {
+                if ((next & (1 << column)) == 0) continue;
+                board.playMove(column);
+                const auto confirmed{negamax(board, -score, -score + 1) <= -score};
+                board.undoLastMove();
+                if (stopped) break;
+                if (confirmed) {
+                    moves[moves_num++] = column;
+                    break;
+                }
+            }
+
+            // Every move loses at once
+            if (next == 0) moves[moves_num++] = __builtin_ctz(board.getValidPositions());
+            if (moves_num == 0) break;
+        }
+
+        for (int idx{0}; idx < moves_num; idx++) {
+            principal_variation.push_back(moves[idx]);
+            board.playMove(moves[idx]);
+            played++;
+            score = -score;
+        }
+    }
+
+    // Restore the board
+    for (; played > 0; played--) board.undoLastMove();
+}
+
+int Solver::solve(Board &board, std::vector<int> &principal_variation) {
+    principal_variation.clear();
+    const auto score{solve(board)};
+    if (stopped || board.checkLastPlayerWin() || board.checkFinishDraw()) return score;
+
+    const auto plays{board.getNumberOfPlays()};
+    extractPrincipalVariation(board, score, principal_variation);
+    root_plays = plays;
+    if (stopped) principal_variation.clear();
+    return score;
+}
+
+std::vector<Solver::MoveAnalysis> Solver::analyze(Board &board) {
+    const auto plays{board.getNumberOfPlays()};
+    const auto valid{board.getValidPositions()};
+    std::vector<MoveAnalysis> analysis;
+
+    for (const auto column : column_order) {
+        if ((valid & (1 << column)) == 0) continue;
+
+        MoveAnalysis move{column, 0, node_count, {column}};
+        board.playMove(column);
+        if (board.checkLastPlayerWin()) {
+            move.score = (CELLS_NUM + 1 - plays) / 2;
+        } else {
+            // The score of the move is the opposite of the score of the opponent
+            move.score = -solve(board, move.principal_variation);
+            move.principal_variation.insert(move.principal_variation.begin(), column);
+        }
+        board.undoLastMove();
+
+        move.nodes = node_count - move.nodes;
+        if (stopped) break;
+        analysis.push_back(move);
+    }
+
+    std::sort(analysis.begin(), analysis.end(), [](const MoveAnalysis &first, const MoveAnalysis &second) {
+        return first.column < second.column;
+    });
+    return analysis;
+}
+
+int Solver::solveFullWindow(Board &board) {
+    const auto plays{board.getNumberOfPlays()};
+    prepareSearch(board);
+
+    if (board.canWinNext()) return (CELLS_NUM + 1 - plays) / 2;
+    if (plays == CELLS_NUM) return 0;
+
+    return negamax(board, -(CELLS_NUM - plays) / 2, (CELLS_NUM + 1 - plays) / 2);
+}
+
+void Solver::setEndgameDatabase(const EndgameDatabase *theDatabase) {
+    endgame_database = theDatabase;
+}
+
+bool Solver::attachSharedTable(const std::string &name) {
+    if (!table.attachShared(name)) return false;
+    table_size = table.getSize();
+    return true;
+}
+
+void Solver::setDeadline(const std::chrono::steady_clock::time_point &theDeadline) {
+    deadline = theDeadline;
+    has_deadline = true;
+}
+
+void Solver::clearDeadline() {
+    has_deadline = false;
+}
+
+void Solver::setStopFlag(const std::atomic<bool> *theFlag) {
+    stop_flag = theFlag;
+}
+
+bool Solver::isStopped() const {
+    return stopped;
+}
+
+int Solver::getMaxDepth() const {
+    return max_depth;
+}
+
+uint64_t Solver::getNodeCount() const {
+    return node_count;
+}
+
+void Solver::reset() {
+    node_count = 0ULL;
+    table.clear();
+    if (wdl_table) wdl_table->clear();
+}
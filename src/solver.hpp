@@ -0,0 +1,247 @@
+#ifndef SOLVER_HPP
+#define SOLVER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "board.hpp"
+#include "endgameDatabase.hpp"
+#include "hashMap.hpp"
+
+/**
+ * @class Solver
+ * A class that computes the exact score of a Board position.
+ * The score of a position is positive when the current player can force a win, negative when the opponent can force a
+ * win and zero for a draw. Its absolute value is the number of pieces the winner still has in hand when the game ends
+ * plus one, so faster wins have bigger scores: a win with the last piece of the board scores 1 and the fastest
+ * possible win scores `MAX_SCORE`.
+ * The search is a negamax with alpha-beta pruning, move ordering and a transposition table that stores upper bounds of
+ * the already explored positions, indexed by the Zobrist hash of the board. The `solve` function drives it with null
+ * windows (MTD(f)-like), bisecting the score range until the exact score is found. The transposition table is kept
+ * between the iterations, so each new null-window search reuses the bounds found by the previous ones.
+ * An optional endgame database cuts the search as soon as a position with few empty cells is reached.
+ * An optional deadline or stop flag (raised by another thread) stops the search. A stopped search does not store
+ * anything in the transposition table, so the bounds found by the completed subtrees are kept for the next searches.
+ */
+class Solver {
+public:
+    /**
+     * @brief Transposition table of the solver: 56 bits of the Zobrist hash and the upper bound of the score.
+     */
+    using TranspositionTable = HashMap<uint64_t, ValueEntry, ModuloIndex>;
+
+private:
+    /**
+     * @brief An entry of the weak solve table: 62 bits of the Zobrist hash and the outcome of the position.
+     */
+    struct WeakEntry {
+        using Value = uint8_t;
+
+        static constexpr Value EMPTY{0}; // No outcome
+
+        uint64_t key : 62; // The 62 least significant bits of the hash
+        uint64_t outcome : 2; // The outcome, from `WeakOutcome` in solver.cpp
+
+        WeakEntry()
+            : key(0ULL), outcome(EMPTY) {};
+
+        WeakEntry(const uint64_t &theKey, const Value &theValue)
+            : key(theKey), outcome(theValue) {};
+
+        bool matches(const uint64_t &theKey) const {
+            return key == (theKey & ((1ULL << 62) - 1ULL));
+        }
+
+        Value getValue() const {
+            return (Value)outcome;
+        }
+    };
+
+    using WeakTable = HashMap<uint64_t, WeakEntry, ModuloIndex>;
+
+    TranspositionTable table; // Transposition table with the upper bounds of the explored positions
+    uint32_t table_size; // Size of the transposition tables
+    std::unique_ptr<WeakTable> wdl_table; // Transposition table of the weak solves, allocated by the first one
+    uint64_t node_count; // Number of nodes explored since the last reset
+    int column_order[9]; // Order in which the columns are explored (center first)
+    const EndgameDatabase *endgame_database; // Database of late positions, or null
+    bool probe_endgame; // Whether the late positions of the current search are covered by the database
+    std::chrono::steady_clock::time_point deadline; // Time at which the search is stopped
+    bool has_deadline; // Whether the deadline is set
+    const std::atomic<bool> *stop_flag; // Flag that stops the search when it is raised, or null
+    bool stopped; // Whether the current search was stopped by the deadline or the stop flag
+    int root_plays; // Number of plays of the root position of the current search
+    int max_depth; // Deepest ply below the root reached by the current search
+    int pv_moves[64][64]; // Triangular array of principal variations, row `ply` holds the moves from the ply `ply`
+    int pv_length[64]; // End of the principal variation of every ply in its row of `pv_moves`
+
+    /**
+     * @brief Prepare the probes of the endgame database for a search.
+     * @param board The root position of the search.
+     */
+    void prepareSearch(const Board &board);
+
+    /**
+     * @brief Recursive negamax search with alpha-beta pruning.
+     * The current player must not be able to win with the next move.
+     * @param board The board to search. It is restored before returning.
+     * @param alpha The lower bound of the search window.
+     * @param beta The upper bound of the search window.
+     * @return The exact score if it is inside the window, otherwise a bound of the score outside the window.
+     */
+    int negamax(Board &board, int alpha, int beta);
+
+    /**
+     * @brief Recursive negamax search of the win, draw or loss outcome of a position, with alpha-beta pruning.
+     * The scores are -1 (loss), 0 (draw) and 1 (win), so the window is at most [-1, 1]. The transposition table
+     * stores a 2-bit outcome per position: a loss, a win, or at most a draw. The current player must not be able to
+     * win with the next move.
+     * @param board The board to search. It is restored before returning.
+     * @param alpha The lower bound of the search window (-1 or 0).
+     * @param beta The upper bound of the search window (0 or 1).
+     * @return The outcome if it is inside the window, otherwise a bound of the outcome outside the window.
+     */
+    int negamaxWeak(Board &board, int alpha, int beta);
+
+    /**
+     * @brief Find the principal variation of a position with a known exact score.
+     * A search with the window around the score fills the triangular array with the moves of the exact scores. When
+     * the variation is cut short (by a bound of the transposition table, the endgame database or an early exit), the
+     * next move is found by walking the table: the first non-losing move whose null-window search confirms the score.
+     * @param board The board. It is restored before returning.
+     * @param score The exact score of the position for the current player.
+     * @param principal_variation The vector to append the moves to.
+     */
+    void extractPrincipalVariation(Board &board, int score, std::vector<int> &principal_variation);
+
+public:
+    static constexpr int CELLS_NUM{63}; // Number of playable cells of the board
+    static constexpr int MIN_SCORE{-(CELLS_NUM / 2) + 3}; // Lowest possible score
+    static constexpr int MAX_SCORE{(CELLS_NUM + 1) / 2 - 3}; // Highest possible score
+
+    /**
+     * @brief The exact score of a move and the best play that follows it.
+     */
+    struct MoveAnalysis {
+        int column; // The column of the move
+        int score; // The score of the position for the current player when the move is played
+        uint64_t nodes; // Number of nodes explored to solve the move
+        std::vector<int> principal_variation; // The move followed by the best moves of both players
+    };
+
+    /**
+     * @brief Constructor.
+     * Initializes a new instance of the Solver class.
+     * @param theTableSize The size of the transposition table. Default value is (1ULL << 19) - 1ULL.
+     */
+    Solver(const uint32_t &theTableSize = (1ULL << 19) - 1ULL);
+
+    /**
+     * @brief Compute the exact score of a position using null-window searches.
+     * @param board The board to solve. It is restored before returning.
+     * @return The score of the position for the current player.
+     */
+    int solve(Board &board);
+
+    /**
+     * @brief Find out if a position is won, drawn or lost, without its exact score (weak solve).
+     * The search only looks for a winning line, so it stops at the first proof and never tells a fast win from a slow
+     * one. It has its own transposition table, allocated by the first call with the size of the main one.
+     * @param board The board to solve. It is restored before returning.
+     * @return 1 if the current player can force a win, 0 for a draw and -1 if the opponent can force a win.
+     */
+    int solveWeak(Board &board);
+
+    /**
+     * @brief Compute the exact score of a position and its principal variation.
+     * The variation ends with the winning move, or with the last cell of the board for a draw, so the score can be
+     * read from its last move.
+     * @param board The board to solve. It is restored before returning.
+     * @param principal_variation The vector that receives the best moves of both players. It is empty if the search
+     * was stopped or the game is over.
+     * @return The score of the position for the current player.
+     */
+    int solve(Board &board, std::vector<int> &principal_variation);
+
+    /**
+     * @brief Compute the exact score and the principal variation of every valid move of a position (multi-PV).
+     * The moves are solved one after the other, center first, with the same transposition table, so the bounds of
+     * the first moves cut the search of the next ones.
+     * @param board The board to analyze. It is restored before returning.
+     * @return The analysis of the valid moves, sorted by column. It stops at the first move whose search is stopped.
+     */
+    std::vector<MoveAnalysis> analyze(Board &board);
+
+    /**
+     * @brief Compute the exact score of a position using a single full-window search.
+     * Slower than `solve`, mostly useful as a reference to compare against.
+     * @param board The board to solve. It is restored before returning.
+     * @return The score of the position for the current player.
+     */
+    int solveFullWindow(Board &board);
+
+    /**
+     * @brief Set the endgame database probed during the search.
+     * The database is only probed when the searched position is below its root position.
+     * @param theDatabase The endgame database, or null to disable the probes. It must outlive the solver.
+     */
+    void setEndgameDatabase(const EndgameDatabase *theDatabase);
+
+    /**
+     * @brief Move the transposition table to a POSIX shared memory segment, shared with the solvers of other processes.
+     * The entries are upper bounds of the positions, so the bounds stored by any process are valid for all of them.
+     * The size of the table becomes the one of the segment when it already exists. `reset` clears the shared table.
+     * @param name The name of the segment, like "/connect4_table".
+     * @return True if the table is shared, false if the segment cannot be created or opened.
+     */
+    bool attachSharedTable(const std::string &name);
+
+    /**
+     * @brief Set a deadline for the next searches.
+     * The clock is checked every 1024 nodes. When the deadline is over, the search unwinds without storing anything
+     * and `isStopped` returns true.
+     * @param theDeadline The time at which the searches are stopped.
+     */
+    void setDeadline(const std::chrono::steady_clock::time_point &theDeadline);
+
+    /**
+     * @brief Remove the deadline of the searches.
+     */
+    void clearDeadline();
+
+    /**
+     * @brief Set a flag that stops the searches when another thread raises it.
+     * The flag is checked every 1024 nodes, like the deadline.
+     * @param theFlag The stop flag, or null to remove it. It must outlive the searches.
+     */
+    void setStopFlag(const std::atomic<bool> *theFlag);
+
+    /**
+     * @brief Check if the last search was stopped by the deadline or the stop flag.
+     * The score returned by a stopped search is meaningless.
+     * @return True if the last search was stopped, false otherwise.
+     */
+    bool isStopped() const;
+
+    /**
+     * @brief Get the deepest ply below the root position reached by the last search.
+     * @return The maximum depth of the last search.
+     */
+    int getMaxDepth() const;
+
+    /**
+     * @brief Get the number of nodes explored since the last reset.
+     * @return The number of explored nodes.
+     */
+    uint64_t getNodeCount() const;
+
+    /**
+     * @brief Reset the node counter and clear the transposition tables.
+     */
+    void reset();
+
+};
+
+#endif
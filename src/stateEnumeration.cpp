@@ -0,0 +1,430 @@
+#include "stateEnumeration.hpp"
+#include "general.hpp"
+#include "positionArray.hpp"
+#include <sys/resource.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+constexpr auto COLS_NUM{9}; // Number of columns
+constexpr auto PARTITIONS_NUM{64}; // Partitions of a ply, by the heights of the columns 8 and 7
+constexpr size_t MIN_CAPACITY{1024}; // Smallest number of slots of a hash set
+constexpr size_t FLUSH_SIZE{1024}; // Children buffered by a thread for a partition before inserting them
+constexpr size_t CHUNK_SIZE{4096}; // Positions per work item and per read of a file
+
+/**
+ * @brief The positions of a partition of a ply: the hash set being filled, the runs spilled to disk, and the sorted
+ * positions once the ply is finished, either in memory or in a file when the partition was spilled.
+ */
+struct Partition {
+    std::mutex mutex; // Protects the hash set and the runs while the ply is expanded
+    std::vector<PackedPosition> slots; // Open addressing hash set, its capacity is a power of two
+    size_t size{0}; // Number of positions in the hash set
+    std::vector<std::string> runs; // Sorted runs spilled to disk
+    std::vector<PackedPosition> states; // Sorted positions of the finished ply, when they stayed in memory
+    std::string path; // File of the sorted positions of the finished ply, when the partition was spilled
+    uint64_t states_num{0ULL}; // Number of positions of the finished ply
+    uint64_t wins_num{0ULL}; // Number of won positions of the finished ply
+    uint64_t runs_num{0ULL}; // Number of runs spilled during the ply
+};
+
+/**
+ * @brief A part of the positions of a partition, expanded by one thread.
+ */
+struct WorkItem {
+    int partition; // Index of the partition
+    uint64_t first; // Index of the first position
+    uint64_t last; // Index after the last position
+};
+
+/**
+ * @brief Check if a slot of a hash set is empty (the empty board is never inserted).
+ */
+static bool isEmptySlot(const PackedPosition &position) {
+    return position.board_tail == 0ULL && position.board_head == 0;
+}
+
+/**
+ * @brief Check if two positions have the same bitboards.
+ */
+static bool isSamePosition(const PackedPosition &lhs, const PackedPosition &rhs) {
+    return lhs.board_tail == rhs.board_tail && lhs.player_tail == rhs.player_tail &&
+        lhs.board_head == rhs.board_head && lhs.player_head == rhs.player_head;
+}
+
+/**
+ * @brief Hash the bitboards of a position (splitmix64 finalizer).
+ */
+static uint64_t hashPosition(const PackedPosition &position) {
+    auto hash{position.board_tail ^ (position.player_tail * 0x9E3779B97F4A7C15ULL) ^
+        ((uint64_t)position.board_head << 48) ^ ((uint64_t)position.player_head << 56)};
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+/**
+ * @brief Get the partition of a position from the heights of the columns 8 and 7, in the order of `comparePositions`.
+ */
+static int getPartition(const PackedPosition &position) {
+    return __builtin_popcount(position.board_head) * 8 + __builtin_popcount((uint32_t)(position.board_tail >> 56));
+}
+
+/**
+ * @brief Get the canonical orientation of a position: the smallest one of the position and its mirror image.
+ */
+static PackedPosition getCanonicalPosition(const PackedPosition &position) {
+    const auto mirrored{mirrorPosition(position)};
+    return comparePositions(mirrored, position) ? mirrored : position;
+}
+
+/**
+ * @brief Get the name of a temporary file of the enumeration.
+ */
+static std::string getTemporaryPath(const std::string &directory, const int &ply, const int &partition,
+    const std::string &suffix) {
+    return directory + "/c4_ply" + std::to_string(ply) + "_part" + std::to_string(partition) + suffix + ".tmp";
+}
+
+/**
+ * @brief Take the positions out of the hash set of a partition, sorted, and leave the hash set empty.
+ */
+static std::vector<PackedPosition> takeSortedPositions(Partition &partition) {
+    std::vector<PackedPosition> positions;
+    positions.reserve(partition.size);
+    for (auto &slot : partition.slots) {
+        if (!isEmptySlot(slot)) positions.push_back(slot);
+        slot = PackedPosition{};
+    }
+    partition.size = 0;
+    std::sort(positions.begin(), positions.end(), comparePositions);
+    return positions;
+}
+
+/**
+ * @brief Write positions to a file, raw and without header.
+ * @return True if the file was written.
+ */
+static bool writePositions(const std::string &path, const std::vector<PackedPosition> &positions) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write((const char *)positions.data(), positions.size() * sizeof(PackedPosition));
+    return file.good();
+}
+
+/**
+ * @brief Insert a position into the hash set of a partition, which must be locked.
+ * A full hash set doubles its capacity while the hash sets of all the partitions fit in the memory budget, or while it
+ * stays within its share of the budget so the small partitions are not spilled in many tiny runs. Otherwise it is
+ * spilled to disk as a sorted run and emptied.
+ */
+static void insertPosition(Partition &partition, const PackedPosition &position, std::atomic<uint64_t> &memory,
+    const uint64_t &budget, const std::string &directory, const int &ply, const int &index) {
+    if ((partition.size + 1) * 2 > partition.slots.size()) {
+        const auto capacity{std::max(MIN_CAPACITY, partition.slots.size() * 2)};
+        const auto growth{(capacity - partition.slots.size()) * sizeof(PackedPosition)};
+        if (memory.fetch_add(growth) + growth <= budget || capacity * sizeof(PackedPosition) * PARTITIONS_NUM <= budget ||
+            partition.slots.empty()) {
+            std::vector<PackedPosition> slots(capacity);
+            const auto mask{slots.size() - 1};
+            for (const auto &slot : partition.slots) {
+                if (isEmptySlot(slot)) continue;
+                auto idx{hashPosition(slot) & mask};
+                while (!isEmptySlot(slots[idx])) idx = (idx + 1) & mask;
+                slots[idx] = slot;
+            }
+            partition.slots.swap(slots);
+        } else {
+            memory -= growth;
+            const auto path{getTemporaryPath(directory, ply, index, "_run" + std::to_string(partition.runs.size()))};
+            if (!writePositions(path, takeSortedPositions(partition))) {
+                throw std::runtime_error("Cannot write the run " + path);
+            }
+            partition.runs.push_back(path);
+        }
+    }
+
+    const auto mask{partition.slots.size() - 1};
+    auto idx{hashPosition(position) & mask};
+    while (!isEmptySlot(partition.slots[idx])) {
+        if (isSamePosition(partition.slots[idx], position)) return;
+        idx = (idx + 1) & mask;
+    }
+    partition.slots[idx] = position;
+    partition.size++;
+}
+
+/**
+ * @brief A buffered reader of the positions of a file.
+ */
+class PositionReader {
+private:
+    std::ifstream file; // The file
+    std::vector<PackedPosition> buffer; // Positions read from the file
+    size_t chunk_size; // Number of positions per read
+    size_t next; // Index of the next position in the buffer
+    uint64_t remaining; // Number of positions left in the file after the buffer
+
+public:
+    PositionReader(const std::string &path, const uint64_t &first, const uint64_t &last,
+        const size_t &theChunkSize = CHUNK_SIZE)
+        : file(path, std::ios::binary), chunk_size(theChunkSize), next(0), remaining(last - first) {
+        file.seekg(first * sizeof(PackedPosition));
+    }
+
+    /**
+     * @brief Read the next position.
+     * @return False when there are no positions left.
+     */
+    bool read(PackedPosition &position) {
+        if (next == buffer.size()) {
+            if (remaining == 0) return false;
+            buffer.resize(std::min<uint64_t>(chunk_size, remaining));
+            file.read((char *)buffer.data(), buffer.size() * sizeof(PackedPosition));
+            if (!file) throw std::runtime_error("Cannot read a file of the enumeration.");
+            remaining -= buffer.size();
+            next = 0;
+        }
+        position = buffer[next++];
+        return true;
+    }
+};
+
+/**
+ * @brief Finish a partition of a ply: sort its positions and merge them with its runs, without duplicates.
+ * The read buffers of the merge use at most the given memory.
+ */
+static void finishPartition(Partition &partition, const uint64_t &memory, const std::string &directory, const int &ply,
+    const int &index) {
+    auto positions{takeSortedPositions(partition)};
+    std::vector<PackedPosition>().swap(partition.slots);
+
+    if (partition.runs.empty()) {
+        for (const auto &position : positions) partition.wins_num += position.label;
+        partition.states_num = positions.size();
+        partition.states = std::move(positions);
+        return;
+    }
+
+    // The last run is the content of the hash set
+    partition.runs.push_back(getTemporaryPath(directory, ply, index, "_run" + std::to_string(partition.runs.size())));
+    if (!writePositions(partition.runs.back(), positions)) {
+        throw std::runtime_error("Cannot write the run " + partition.runs.back());
+    }
+    std::vector<PackedPosition>().swap(positions);
+
+    // Merge the runs, always taking the smallest next position of all of them
+    const auto chunk_size{std::min(CHUNK_SIZE,
+        std::max<size_t>(16, memory / sizeof(PackedPosition) / partition.runs.size()))};
+    std::vector<std::unique_ptr<PositionReader>> readers;
+    const auto greater{[](const std::pair<PackedPosition, size_t> &lhs, const std::pair<PackedPosition, size_t> &rhs) {
+        return comparePositions(rhs.first, lhs.first);
+    }};
+    std::priority_queue<std::pair<PackedPosition, size_t>, std::vector<std::pair<PackedPosition, size_t>>,
+        decltype(greater)> heads(greater);
+    for (const auto &run : partition.runs) {
+        std::ifstream file(run, std::ios::binary | std::ios::ate);
+        readers.emplace_back(new PositionReader(run, 0ULL, (uint64_t)file.tellg() / sizeof(PackedPosition), chunk_size));
+        PackedPosition position;
+        if (readers.back()->read(position)) heads.emplace(position, readers.size() - 1);
+    }
+
+    partition.path = getTemporaryPath(directory, ply, index, "");
+    std::ofstream file(partition.path, std::ios::binary | std::ios::trunc);
+    std::vector<PackedPosition> buffer;
+    buffer.reserve(CHUNK_SIZE);
+    while (!heads.empty()) {
+        const auto head{heads.top()};
+        heads.pop();
+        PackedPosition position;
+        if (readers[head.second]->read(position)) heads.emplace(position, head.second);
+        if (!buffer.empty() && isSamePosition(buffer.back(), head.first)) continue;
+        if (buffer.size() == CHUNK_SIZE) {
+            file.write((const char *)buffer.data(), buffer.size() * sizeof(PackedPosition));
+            buffer.clear();
+        }
+        buffer.push_back(head.first);
+        partition.states_num++;
+        partition.wins_num += head.first.label;
+    }
+    file.write((const char *)buffer.data(), buffer.size() * sizeof(PackedPosition));
+    if (!file.good()) throw std::runtime_error("Cannot write " + partition.path);
+
+    readers.clear();
+    partition.runs_num = partition.runs.size();
+    for (const auto &run : partition.runs) std::remove(run.c_str());
+    partition.runs.clear();
+}
+
+/**
+ * @brief Call a function with every position of a part of a finished partition, from memory or from its file.
+ */
+template <typename Function>
+static void forEachPosition(const Partition &partition, const uint64_t &first, const uint64_t &last,
+    const Function &function) {
+    if (partition.path.empty()) {
+        for (auto idx{first}; idx < last; idx++) function(partition.states[idx]);
+        return;
+    }
+    PositionReader reader(partition.path, first, last);
+    PackedPosition position;
+    while (reader.read(position)) function(position);
+}
+
+uint64_t getPeakMemory() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0ULL;
+    #ifdef __APPLE__
+    return (uint64_t)usage.ru_maxrss;
+    #else
+    return (uint64_t)usage.ru_maxrss * 1024ULL;
+    #endif
+}
+
+/**
+ * @brief Write a finished ply as a position array, concatenating its partitions.
+ */
+static void writePly(const std::unique_ptr<Partition[]> &partitions, const std::string &path) {
+    PositionArrayWriter writer;
+    if (!writer.open(path)) throw std::runtime_error("Cannot write " + path);
+    for (int idx{0}; idx < PARTITIONS_NUM; idx++) {
+        forEachPosition(partitions[idx], 0ULL, partitions[idx].states_num,
+            [&writer](const PackedPosition &position) {writer.add(position);});
+    }
+    if (!writer.close()) throw std::runtime_error("Cannot write " + path);
+}
+
+std::vector<PlyStats> enumerateStates(const EnumerationSettings &settings,
+    const std::function<void(const PlyStats &)> &progress) {
+    #ifdef DEBUG
+    assertLogic(settings.threads > 0, "The enumeration needs at least one thread.");
+    #endif
+
+    const auto threads_num{std::max(1, settings.threads)};
+    const auto start{std::chrono::steady_clock::now()};
+
+    // The ply 0 is the empty board
+    std::unique_ptr<Partition[]> current(new Partition[PARTITIONS_NUM]);
+    current[0].states.push_back(packPosition(Board{}));
+    current[0].states_num = 1ULL;
+
+    std::vector<PlyStats> results;
+    results.push_back(PlyStats{0, 1ULL, 0ULL, 0ULL, 0ULL,
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), getPeakMemory()});
+    if (!settings.output_prefix.empty()) writePly(current, settings.output_prefix + "0.bin");
+    if (progress) progress(results.back());
+
+    for (int ply{1}; ply <= settings.max_plies && ply <= COLS_NUM * 7; ply++) {
+        const auto ply_start{std::chrono::steady_clock::now()};
+        std::unique_ptr<Partition[]> next(new Partition[PARTITIONS_NUM]);
+
+        std::vector<WorkItem> items;
+        for (int idx{0}; idx < PARTITIONS_NUM; idx++) {
+            for (uint64_t first{0ULL}; first < current[idx].states_num; first += CHUNK_SIZE) {
+                items.push_back(WorkItem{idx, first, std::min<uint64_t>(first + CHUNK_SIZE, current[idx].states_num)});
+            }
+        }
+
+        // Expand the positions of the previous ply, buffering the children of every partition
+        std::atomic<size_t> next_item{0};
+        std::atomic<uint64_t> memory{0ULL};
+        std::atomic<uint64_t> generated{0ULL};
+        const auto expand{[&]() {
+            std::vector<std::vector<PackedPosition>> buffers(PARTITIONS_NUM);
+            const auto flush{[&](const int &index) {
+                std::lock_guard<std::mutex> lock(next[index].mutex);
+                for (const auto &child : buffers[index]) {
+                    insertPosition(next[index], child, memory, settings.memory_budget, settings.spill_directory, ply,
+                        index);
+                }
+                buffers[index].clear();
+            }};
+
+            uint64_t children{0ULL};
+            for (auto item{next_item++}; item < items.size(); item = next_item++) {
+                forEachPosition(current[items[item].partition], items[item].first, items[item].last,
+                    [&](const PackedPosition &position) {
+                    // The game is over after a line of four
+                    if (position.label != 0) return;
+
+                    Board board;
+                    if (!unpackPosition(position, board)) throw std::runtime_error("Corrupt position in the enumeration.");
+                    for (int column{0}; column < COLS_NUM; column++) {
+                        if (!board.isValidPosition(column)) continue;
+
+                        board.playMove(column);
+                        const auto child{getCanonicalPosition(packPosition(board, board.checkLastPlayerWin() ? 1 : 0))};
+                        board.undoLastMove();
+
+                        const auto index{getPartition(child)};
+                        buffers[index].push_back(child);
+                        if (buffers[index].size() == FLUSH_SIZE) flush(index);
+                        children++;
+                    }
+                });
+            }
+            for (int index{0}; index < PARTITIONS_NUM; index++) flush(index);
+            generated += children;
+        }};
+
+        // Sort and merge the partitions of the new ply
+        std::atomic<int> next_partition{0};
+        const auto finish{[&]() {
+            for (auto index{next_partition++}; index < PARTITIONS_NUM; index = next_partition++) {
+                finishPartition(next[index], settings.memory_budget / threads_num, settings.spill_directory, ply, index);
+            }
+        }};
+
+        // The first error of a thread is raised once all of them stopped
+        for (const auto &task : {std::function<void()>(expand), std::function<void()>(finish)}) {
+            std::mutex error_mutex;
+            std::exception_ptr error;
+            const auto run{[&]() {
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) error = std::current_exception();
+                }
+            }};
+            std::vector<std::thread> workers;
+            for (int idx{1}; idx < threads_num; idx++) workers.emplace_back(run);
+            run();
+            for (auto &worker : workers) worker.join();
+            if (error) std::rethrow_exception(error);
+        }
+
+        // The previous ply is not needed anymore
+        for (int idx{0}; idx < PARTITIONS_NUM; idx++) {
+            if (!current[idx].path.empty()) std::remove(current[idx].path.c_str());
+        }
+        current.swap(next);
+
+        PlyStats stats;
+        stats.ply = ply;
+        stats.generated = generated;
+        for (int idx{0}; idx < PARTITIONS_NUM; idx++) {
+            stats.states += current[idx].states_num;
+            stats.wins += current[idx].wins_num;
+            stats.runs += current[idx].runs_num;
+        }
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - ply_start).count();
+        stats.peak_memory = getPeakMemory();
+
+        if (!settings.output_prefix.empty()) writePly(current, settings.output_prefix + std::to_string(ply) + ".bin");
+        results.push_back(stats);
+        if (progress) progress(stats);
+    }
+
+    for (int idx{0}; idx < PARTITIONS_NUM; idx++) {
+        if (!current[idx].path.empty()) std::remove(current[idx].path.c_str());
+    }
+    return results;
+}
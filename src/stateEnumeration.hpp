@@ -0,0 +1,62 @@
+#ifndef STATEENUMERATION_HPP
+#define STATEENUMERATION_HPP
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The settings of an enumeration of the reachable positions.
+ */
+struct EnumerationSettings {
+    int max_plies{8}; // Last ply to enumerate
+    int threads{1}; // Number of threads
+    uint64_t memory_budget{1ULL << 30}; // Bytes of the hash sets of a ply (all partitions), spilled to disk beyond it
+    std::string spill_directory{"."}; // Directory of the temporary files
+    std::string output_prefix{}; // The positions of every ply are written to `<prefix><ply>.bin`, empty for none
+};
+
+/**
+ * @brief The result of the enumeration of a ply.
+ */
+struct PlyStats {
+    int ply{0}; // Number of plays of the positions
+    uint64_t states{0ULL}; // Number of distinct positions, a position and its mirror image counting once
+    uint64_t wins{0ULL}; // Number of those positions where the last move made a line of four
+    uint64_t generated{0ULL}; // Number of generated children, before deduplication
+    uint64_t runs{0ULL}; // Number of sorted runs spilled to disk
+    double seconds{0.0}; // Time of the ply
+    uint64_t peak_memory{0ULL}; // Peak resident memory of the process in bytes at the end of the ply
+
+    /**
+     * @brief Get the number of distinct positions found per second.
+     * @return The states per second.
+     */
+    double getStatesPerSecond() const {return seconds > 0.0 ? states / seconds : 0.0;}
+};
+
+/**
+ * @brief Get the peak resident memory of the process.
+ * @return The peak resident set size in bytes.
+ */
+uint64_t getPeakMemory();
+
+/**
+ * @brief Enumerate the distinct positions reachable from the empty board, ply by ply (breadth first).
+ * Every ply is split in 64 partitions by the heights of the columns 8 and 7. The threads expand the positions of the
+ * previous ply and insert the children into the hash set of their partition, which keeps the canonical orientation
+ * of each position (the smallest one of the position and its mirror image for `comparePositions`, like the books).
+ * The positions where the last move won are counted but not expanded. When a hash set has to grow beyond the memory
+ * budget of all of them, it is sorted and spilled to disk as a run instead, and the runs of every partition are merged
+ * without duplicates at the end of the ply. The partitions are sorted and ordered like `comparePositions`, so a ply is
+ * written as a valid position array (labeled 1 for the won positions, 0 otherwise) by concatenating them.
+ * @param settings The settings of the enumeration.
+ * @param progress Function called with the result of every ply, can be empty.
+ * @return The results of the plies, from the ply 0 to the last one.
+ * @throws std::runtime_error if a temporary or output file cannot be written or read.
+ */
+std::vector<PlyStats> enumerateStates(const EnumerationSettings &settings,
+    const std::function<void(const PlyStats &)> &progress = std::function<void(const PlyStats &)>());
+
+#endif
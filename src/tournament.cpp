@@ -0,0 +1,172 @@
+#include "tournament.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+double computeLLR(const int &wins, const int &draws, const int &losses, const double &elo0, const double &elo1) {
+    const auto games{wins + draws + losses};
+    if (games == 0) return 0.0;
+
+    // Half a game is added to every result, so that a run with only wins or only losses still has a variance
+    const auto regularized_wins{wins + 0.5};
+    const auto regularized_draws{draws + 0.5};
+    const auto regularized_losses{losses + 0.5};
+    const auto regularized_games{games + 1.5};
+
+    // Mean and variance of the game scores
+    const auto mean{(regularized_wins + 0.5 * regularized_draws) / regularized_games};
+    const auto variance{(regularized_wins * (1.0 - mean) * (1.0 - mean) + regularized_draws * (0.5 - mean) *
+        (0.5 - mean) + regularized_losses * mean * mean) / regularized_games};
+
+    // Expected scores of the hypotheses
+    const auto score0{1.0 / (1.0 + std::pow(10.0, -elo0 / 400.0))};
+    const auto score1{1.0 / (1.0 + std::pow(10.0, -elo1 / 400.0))};
+
+    return games * (score1 - score0) * (2.0 * mean - score0 - score1) / (2.0 * variance);
+}
+
+TournamentResult::Decision decideSPRT(const double &llr, const double &alpha, const double &beta) {
+    if (llr >= std::log((1.0 - beta) / alpha)) return TournamentResult::H1;
+    if (llr <= std::log(beta / (1.0 - alpha))) return TournamentResult::H0;
+    return TournamentResult::NONE;
+}
+
+/**
+ * @brief Generate the random opening of a pair of games.
+ * The random moves never give an immediate win to the next player, and the opening stops early if no such move exists.
+ * @param plies The number of random moves.
+ * @param seed The seed of the opening.
+ * @return The columns of the opening.
+ */
+static std::string generateOpening(const int &plies, const uint64_t &seed) {
+    std::mt19937_64 generator{seed};
+    std::string opening;
+    Board board;
+    for (int ply{0}; ply < plies; ply++) {
+        if (board.canWinNext()) break;
+        const auto next{board.getNonLosingPositions()};
+        if (next == 0) break;
+
+        // Take one of the non-losing columns at random
+        auto choice{(int)(generator() % __builtin_popcount(next))};
+        auto column{0};
+        for (; column < 9; column++) {
+            if ((next & (1 << column)) != 0 && choice-- == 0) break;
+        }
+
+        board.playMove(column);
+        opening += (char)('0' + column);
+    }
+    return opening;
+}
+
+int playGame(Engine *engines[2], const EngineSettings *settings[2], const std::string &opening, SideStats *stats[2]) {
+    Board board;
+    for (const auto engine : {engines[0], engines[1]}) engine->newGame();
+    for (const auto column : opening) {
+        board.playMove(column - '0');
+        engines[0]->playMove(column - '0');
+        engines[1]->playMove(column - '0');
+    }
+
+    while (true) {
+        // The first player moves when the number of plays is even
+        const auto side{board.getNumberOfPlays() % 2};
+        const auto start{std::chrono::steady_clock::now()};
+        const auto move{engines[side]->chooseMove(start + std::chrono::milliseconds(settings[side]->move_time_ms))};
+        const auto seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+        stats[side]->moves++;
+        stats[side]->nodes += move.nodes;
+        stats[side]->seconds += seconds;
+        if (move.source == Engine::SOLVED || move.source == Engine::HEURISTIC) {
+            stats[side]->searched_moves++;
+            stats[side]->depth_sum += move.depth;
+        }
+
+        board.playMove(move.column);
+        engines[0]->playMove(move.column);
+        engines[1]->playMove(move.column);
+
+        if (board.checkLastPlayerWin()) return side == 0 ? 1 : -1;
+        if (board.checkFinishDraw()) return 0;
+    }
+}
+
+/**
+ * @brief Add the statistics of some moves to other statistics.
+ * @param total The statistics to update.
+ * @param stats The statistics to add.
+ */
+static void addStats(SideStats &total, const SideStats &stats) {
+    total.moves += stats.moves;
+    total.searched_moves += stats.searched_moves;
+    total.nodes += stats.nodes;
+    total.depth_sum += stats.depth_sum;
+    total.seconds += stats.seconds;
+}
+
+TournamentResult runTournament(const TournamentSettings &settings,
+    const std::function<void(const TournamentResult &)> &progress) {
+    TournamentResult result;
+    std::mutex result_mutex;
+    std::atomic<int> next_game{0};
+    std::atomic<bool> decided{false};
+    const auto start{std::chrono::steady_clock::now()};
+
+    const auto play = [&]() {
+        // The engines of a thread are kept between its games
+        std::unique_ptr<Engine> first{new Engine(settings.first.table_size)};
+        std::unique_ptr<Engine> second{new Engine(settings.second.table_size)};
+        if (!settings.first.book_path.empty()) first->loadBook(settings.first.book_path);
+        if (!settings.second.book_path.empty()) second->loadBook(settings.second.book_path);
+        first->setProofNumberLimit(settings.first.proof_nodes);
+        second->setProofNumberLimit(settings.second.proof_nodes);
+
+        while (!decided) {
+            const auto game{next_game++};
+            if (game >= settings.games) break;
+
+            // Both games of a pair share the opening, the first engine plays first in the even games
+            const auto opening{generateOpening(settings.opening_plies, settings.seed * 0x9E3779B97F4A7C15ULL + game / 2)};
+            const auto swapped{game % 2 == 1};
+            SideStats first_stats, second_stats;
+            Engine *engines[2]{first.get(), second.get()};
+            const EngineSettings *engine_settings[2]{&settings.first, &settings.second};
+            SideStats *stats[2]{&first_stats, &second_stats};
+            if (swapped) {
+                std::swap(engines[0], engines[1]);
+                std::swap(engine_settings[0], engine_settings[1]);
+                std::swap(stats[0], stats[1]);
+            }
+            const auto outcome{playGame(engines, engine_settings, opening, stats) * (swapped ? -1 : 1)};
+
+            std::lock_guard<std::mutex> lock{result_mutex};
+            if (outcome > 0) result.wins++;
+            else if (outcome < 0) result.losses++;
+            else result.draws++;
+            addStats(result.first_stats, first_stats);
+            addStats(result.second_stats, second_stats);
+
+            // Stop as soon as one of the hypotheses is accepted
+            result.llr = computeLLR(result.wins, result.draws, result.losses, settings.elo0, settings.elo1);
+            result.decision = decideSPRT(result.llr, settings.alpha, settings.beta);
+            if (result.decision != TournamentResult::NONE) decided = true;
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (progress) progress(result);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int thread{1}; thread < settings.threads; thread++) threads.emplace_back(play);
+    play();
+    for (auto &thread : threads) thread.join();
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
@@ -0,0 +1,129 @@
+#ifndef TOURNAMENT_HPP
+#define TOURNAMENT_HPP
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include "engine.hpp"
+
+/**
+ * @brief The settings of an engine in a tournament.
+ */
+struct EngineSettings {
+    std::string name{"engine"}; // Name of the engine in the reports
+    uint32_t table_size{(1U << 20) - 3U}; // Size of the transposition table (a prime number)
+    int move_time_ms{50}; // Time of every move in milliseconds (0 stops the searches at their first clock check)
+    std::string book_path{}; // Path of the opening book, empty for no book
+    uint64_t proof_nodes{0ULL}; // Node limit of the proof-number pre-check, 0 to skip it
+};
+
+/**
+ * @brief The statistics of the moves of an engine.
+ */
+struct SideStats {
+    uint64_t moves{0}; // Number of played moves
+    uint64_t searched_moves{0}; // Number of moves chosen with a search
+    uint64_t nodes{0}; // Number of explored nodes
+    uint64_t depth_sum{0}; // Sum of the depths of the searched moves
+    double seconds{0.0}; // Time spent choosing the moves
+
+    /**
+     * @brief Get the average depth of the searched moves.
+     * @return The average depth, or 0 without searched moves.
+     */
+    double getAverageDepth() const {return searched_moves ? (double)depth_sum / searched_moves : 0.0;}
+
+    /**
+     * @brief Get the search speed.
+     * @return The number of nodes per second, or 0 without time.
+     */
+    double getNodesPerSecond() const {return seconds > 0.0 ? nodes / seconds : 0.0;}
+};
+
+/**
+ * @brief The settings of a tournament between two engines.
+ * The games are played in pairs: both games of a pair start from the same random opening and the engines swap
+ * colors. The second player cannot steal the first piece.
+ */
+struct TournamentSettings {
+    EngineSettings first; // The tested engine
+    EngineSettings second; // The reference engine
+    int games{200}; // Maximum number of games
+    int threads{1}; // Number of games played at the same time (one per thread)
+    int opening_plies{4}; // Number of random moves of the openings
+    uint64_t seed{1ULL}; // Seed of the random openings
+    double elo0{0.0}; // Elo difference of the null hypothesis of the SPRT
+    double elo1{10.0}; // Elo difference of the alternative hypothesis of the SPRT
+    double alpha{0.05}; // Probability of accepting the alternative hypothesis when the null one is true
+    double beta{0.05}; // Probability of accepting the null hypothesis when the alternative one is true
+};
+
+/**
+ * @brief The results of a tournament, from the point of view of the first engine.
+ */
+struct TournamentResult {
+    /**
+     * @brief The decision of the SPRT.
+     */
+    enum Decision {
+        NONE, // Not enough games to decide
+        H0, // The Elo difference of the first engine is `elo0` or less
+        H1 // The Elo difference of the first engine is `elo1` or more
+    };
+
+    int wins{0}; // Games won by the first engine
+    int draws{0}; // Drawn games
+    int losses{0}; // Games lost by the first engine
+    double llr{0.0}; // Log-likelihood ratio of the SPRT
+    Decision decision{NONE}; // Decision of the SPRT
+    SideStats first_stats; // Statistics of the first engine
+    SideStats second_stats; // Statistics of the second engine
+    double seconds{0.0}; // Wall time of the tournament
+};
+
+/**
+ * @brief Compute the log-likelihood ratio of a sequential probability ratio test on game results.
+ * The games are scored 1, 1/2 and 0 and the score distribution is approximated with its mean and variance (the
+ * generalized SPRT used by the chess engine testing frameworks). Half a game is added to each result before
+ * computing them, so that a run with only wins or only losses still gets a decision.
+ * @param wins The number of wins.
+ * @param draws The number of draws.
+ * @param losses The number of losses.
+ * @param elo0 The Elo difference of the null hypothesis.
+ * @param elo1 The Elo difference of the alternative hypothesis.
+ * @return The log-likelihood ratio of the alternative hypothesis against the null one, 0 if no game was played.
+ */
+double computeLLR(const int &wins, const int &draws, const int &losses, const double &elo0, const double &elo1);
+
+/**
+ * @brief Decide a sequential probability ratio test.
+ * @param llr The log-likelihood ratio.
+ * @param alpha The probability of accepting the alternative hypothesis when the null one is true.
+ * @param beta The probability of accepting the null hypothesis when the alternative one is true.
+ * @return H1 above the upper bound log((1 - beta) / alpha), H0 below the lower bound log(beta / (1 - alpha)) and NONE
+ * between them.
+ */
+TournamentResult::Decision decideSPRT(const double &llr, const double &alpha, const double &beta);
+
+/**
+ * @brief Play a game between two engines.
+ * @param engines The engine of the first player and the engine of the second player.
+ * @param settings The settings of the first player and of the second player.
+ * @param opening The columns of the opening, played before the engines move.
+ * @param stats The statistics of the first player and of the second player, updated with the game.
+ * @return 1 if the first player wins, -1 if the second player wins, 0 for a draw.
+ */
+int playGame(Engine *engines[2], const EngineSettings *settings[2], const std::string &opening, SideStats *stats[2]);
+
+/**
+ * @brief Run a tournament between two engines, with one game per thread.
+ * The tournament stops at the maximum number of games or as soon as the SPRT accepts one of the hypotheses (the
+ * games that are being played are finished).
+ * @param settings The settings of the tournament.
+ * @param progress Function called after every game with the current results, under a lock. Can be empty.
+ * @return The results of the tournament.
+ */
+TournamentResult runTournament(const TournamentSettings &settings,
+    const std::function<void(const TournamentResult &)> &progress = std::function<void(const TournamentResult &)>());
+
+#endif
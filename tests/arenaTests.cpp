@@ -0,0 +1,111 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/arena.hpp"
+#include "../src/proofNumberSearch.hpp"
+#include "../src/solver.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counting allocator hook: every heap allocation of the test program goes through these operators
+static std::atomic<uint64_t> heap_allocations{0ULL};
+
+void *operator new(std::size_t size) {
+    heap_allocations++;
+    if (void *memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void runArenaTests() {
+
+    std::cout << ansi::foreground_yellow << "ARENA TESTS" << ansi::reset << std::endl;
+
+    { // Function allocate Test
+
+        Arena arena{1024};
+
+        auto *first = arena.allocateArray<char>(3);
+        auto *second = arena.allocateArray<uint64_t>(4);
+
+        EQ_TEST((std::vector<uint64_t>){(uint64_t)(first != nullptr), (uint64_t)second % alignof(uint64_t),
+                arena.getUsed(), arena.getCapacity()},
+            (std::vector<uint64_t>){1ULL, 0ULL, 8ULL + 4ULL * sizeof(uint64_t), 1024ULL}, "Function allocate Test");
+    }
+
+    { // Function reset Test
+
+        Arena arena{1024};
+
+        auto *first = arena.allocateArray<int>(16);
+        arena.reset();
+        auto *second = arena.allocateArray<int>(16);
+
+        EQ_TEST((std::vector<uint64_t>){(uint64_t)(first == second), arena.getUsed()},
+            (std::vector<uint64_t>){1ULL, 16ULL * sizeof(int)}, "Function reset Test");
+    }
+
+    { // ArenaScope Test
+
+        Arena arena{1024};
+        arena.allocateArray<int>(4);
+        const auto used_before{arena.getUsed()};
+
+        {
+            ArenaScope scope{arena};
+            arena.allocateArray<int>(64);
+        }
+
+        EQ_TEST(arena.getUsed(), used_before, "ArenaScope Test");
+    }
+
+    { // Zero Heap Allocations Test 1
+
+        Board game;
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+        Solver solver;
+
+        const auto allocations_before{heap_allocations.load()};
+        solver.solve(game);
+        const auto allocations_after{heap_allocations.load()};
+
+        // The search explores thousands of nodes without any heap allocation
+        EQ_TEST((std::vector<uint64_t>){allocations_after - allocations_before, (uint64_t)(solver.getNodeCount() > 1000ULL)},
+            (std::vector<uint64_t>){0ULL, 1ULL}, "Zero Heap Allocations Test 1");
+    }
+
+    { // Zero Heap Allocations Test 2
+
+        Board game;
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+        Solver solver;
+        ProofNumberSearch prover;
+        std::vector<int> principal_variation;
+        principal_variation.reserve(64);
+        Arena::getThreadArena();
+
+        const auto allocations_before{heap_allocations.load()};
+        solver.solve(game, principal_variation);
+        prover.search(game, 100000ULL);
+        prover.reset();
+        prover.search(game, 100000ULL);
+        const auto allocations_after{heap_allocations.load()};
+
+        // The principal variation and the node table of the proof-number search come from arenas
+        EQ_TEST((std::vector<uint64_t>){allocations_after - allocations_before, (uint64_t)(principal_variation.size() > 1),
+                (uint64_t)(prover.getNodeCount() > 1000ULL)},
+            (std::vector<uint64_t>){0ULL, 1ULL, 1ULL}, "Zero Heap Allocations Test 2");
+    }
+
+};
@@ -0,0 +1,116 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/asyncEngine.hpp"
+#include "../src/connect4.h"
+#include <atomic>
+
+/**
+ * @brief Progress callback of the C interface test, counting its calls.
+ */
+static void countProgress(const c4_search_info *, void *user_data) {
+    (*static_cast<int *>(user_data))++;
+}
+
+void runAsyncEngineTests() {
+
+    std::cout << ansi::foreground_yellow << "ASYNC ENGINE TESTS" << ansi::reset << std::endl;
+
+    { // Function startSearch Test 1
+
+        Board game;
+        for (const auto column : std::string{"773452523314200123558107783217015876871040522835803"}) {
+            game.playMove(column - '0');
+        }
+
+        AsyncEngine engine;
+        std::atomic<int> updates{0};
+        const auto handle{engine.startSearch(game, SearchLimits{}, [&](const Engine::Move &) {updates++;})};
+        const auto move{handle->wait()};
+
+        EQ_TEST((std::vector<int>){handle->poll(), move.source, updates > 0, handle->getCancelLatency() < 0.0},
+            (std::vector<int>){true, Engine::SOLVED, true, true}, "Function startSearch Test 1");
+    }
+
+    { // Function startSearch Test 2
+
+        Board game;
+        for (const auto column : std::string{"404040"}) game.playMove(column - '0');
+        game.playMove(4);
+
+        AsyncEngine engine;
+        const auto handle{engine.startSearch(game, SearchLimits{})};
+
+        // The game is over
+        EQ_TEST((std::vector<int>){handle->poll(), handle->getBestMove().column}, (std::vector<int>){true, -1},
+            "Function startSearch Test 2");
+    }
+
+    { // Function cancel Test
+
+        AsyncEngine engine;
+        const auto handle{engine.startSearch(Board{}, SearchLimits{})};
+
+        // The empty board is not solved in 20 ms, and the search stops soon after the cancel
+        const auto finished_early{handle->waitFor(std::chrono::milliseconds(20))};
+        handle->cancel();
+        const auto move{handle->wait()};
+        const auto latency{handle->getCancelLatency()};
+
+        EQ_TEST((std::vector<int>){finished_early, move.source, move.column, latency >= 0.0 && latency < 50.0},
+            (std::vector<int>){false, Engine::HEURISTIC, 4, true}, "Function cancel Test");
+    }
+
+    { // Function c4_search_start Test
+
+        const auto engine{c4_engine_create(0)};
+        const auto invalid{c4_search_start(engine, "40404044", 0, nullptr, nullptr)};
+
+        auto updates{0};
+        c4_search_info info;
+        const auto search{c4_search_start(engine, "40404", 0, countProgress, &updates)};
+        c4_search_wait(search, &info);
+        c4_search_release(search);
+
+        // The second player blocks the column 4
+        EQ_TEST((std::vector<int>){(int)c4_abi_version(), invalid == nullptr, info.column, info.source, info.finished},
+            (std::vector<int>){C4_ABI_VERSION, true, 4, C4_SOURCE_FORCED, 1}, "Function c4_search_start Test");
+        c4_engine_destroy(engine);
+    }
+
+    { // Function c4_search_start_serialized Test
+
+        Board game;
+        for (const auto column : std::string{"773452523314200123558107783217015876871040522835803"}) {
+            game.playMove(column - '0');
+        }
+        uint8_t buffer[Board::SERIALIZED_SIZE];
+        game.serialize(buffer);
+
+        const auto engine{c4_engine_create(0)};
+        auto updates{0};
+        c4_search_info info;
+        const auto search{c4_search_start_serialized(engine, buffer, Board::SERIALIZED_SIZE, 0, countProgress, &updates)};
+        c4_search_wait(search, &info);
+        const auto latency{c4_search_cancel_latency(search)};
+        c4_search_release(search);
+        c4_engine_destroy(engine);
+
+        EQ_TEST((std::vector<int>){info.source, updates > 0, latency < 0.0}, (std::vector<int>){C4_SOURCE_SOLVED, true, true},
+            "Function c4_search_start_serialized Test");
+    }
+
+    { // Null Search Handle Test
+
+        // The search functions do nothing with the NULL handle of a search that could not start
+        c4_search_info info{};
+        info.column = -2;
+        c4_search_wait(nullptr, &info);
+        c4_search_cancel(nullptr);
+        c4_search_get_info(nullptr, &info);
+        c4_search_release(nullptr);
+
+        EQ_TEST((std::vector<int>){c4_search_poll(nullptr), c4_search_wait_for(nullptr, 10), info.column,
+                c4_search_cancel_latency(nullptr) < 0.0}, (std::vector<int>){0, 0, -2, true}, "Null Search Handle Test");
+    }
+
+};
@@ -342,6 +342,56 @@ void runBoardTests() {
         EQ_TEST(game.getWinningPositions(), 290, "Function getWinningPositions Test");
     }
 
+    { // Function canWinNext Test
+
+        Board first_game;
+        for (const auto column : std::string{"404142"}) {
+            first_game.playMove(column - '0');
+        }
+
+        Board second_game;
+        for (const auto column : std::string{"3344"}) {
+            second_game.playMove(column - '0');
+        }
+
+        EQ_TEST((std::vector<bool>){first_game.canWinNext(), second_game.canWinNext()},
+            (std::vector<bool>){true, false}, "Function canWinNext Test");
+    }
+
+    { // Function getNonLosingPositions Test
+
+        Board first_game;
+        for (const auto column : std::string{"3344"}) {
+            first_game.playMove(column - '0');
+        }
+
+        //player 2 has to block the column 2
+        Board second_game;
+        for (const auto column : std::string{"323242"}) {
+            second_game.playMove(column - '0');
+        }
+
+        //player 1 has two open ends in the bottom row
+        Board third_game;
+        for (const auto column : std::string{"33445"}) {
+            third_game.playMove(column - '0');
+        }
+
+        EQ_TEST((std::vector<int>){first_game.getNonLosingPositions(), second_game.getNonLosingPositions(), third_game.getNonLosingPositions()},
+            (std::vector<int>){511, 4, 0}, "Function getNonLosingPositions Test");
+    }
+
+    { // Function getMoveScore Test
+
+        Board game;
+        for (const auto column : std::string{"3344"}) {
+            game.playMove(column - '0');
+        }
+
+        EQ_TEST((std::vector<int>){game.getMoveScore(0), game.getMoveScore(2), game.getMoveScore(5)},
+            (std::vector<int>){0, 2, 2}, "Function getMoveScore Test");
+    }
+
     { // Function isBoardSymmetrical Test 1
 
         Board game;
@@ -394,4 +444,111 @@ void runBoardTests() {
         EQ_TEST(game.isBoardSymmetrical(), true, "Function isBoardSymmetrical Test 3");
     }
 
+    { // Function serialize Test
+
+        Board game;
+        for (const auto column : std::string{"4433210"}) game.playMove(column - '0');
+
+        uint8_t buffer[Board::SERIALIZED_SIZE + 63];
+        const auto written{game.serialize(buffer)};
+        const auto written_history{game.serialize(buffer + Board::SERIALIZED_SIZE, true)};
+
+        EQ_TEST((std::vector<int>){written, written_history, buffer[2], buffer[3 + 4], buffer[3 + 9 + 4]},
+            (std::vector<int>){Board::SERIALIZED_SIZE, Board::SERIALIZED_SIZE + 7, 7, 3, 2}, "Function serialize Test");
+    }
+
+    { // Function deserialize Test
+
+        Board game;
+        for (const auto column : std::string{"4433210"}) game.playMove(column - '0');
+
+        uint8_t buffer[Board::SERIALIZED_SIZE + 63];
+        Board copy, copy_history;
+        const auto read{Board::deserialize(buffer, game.serialize(buffer), copy)};
+        const auto read_history{Board::deserialize(buffer, game.serialize(buffer, true), copy_history)};
+
+        // The board rebuilt with its history can undo its moves
+        const auto player{game.getCurrentPlayer()};
+        copy_history.undoLastMove();
+        game.undoLastMove();
+
+        EQ_TEST((std::vector<int>){read, read_history, copy.getNumberOfPlays(), copy.getCurrentPlayer(),
+                copy.getBoardKey() == copy_history.getBoardKey(), copy_history.getBoardKey() == game.getBoardKey()},
+            (std::vector<int>){Board::SERIALIZED_SIZE, Board::SERIALIZED_SIZE + 7, 7, player, false, true},
+            "Function deserialize Test");
+    }
+
+    { // Function deserialize Test 2
+
+        Board game;
+        for (const auto column : std::string{"4433210"}) game.playMove(column - '0');
+
+        uint8_t buffer[Board::SERIALIZED_SIZE + 63];
+        const auto size{game.serialize(buffer, true)};
+        std::vector<int> results;
+        Board copy;
+
+        // Truncated buffer, floating piece, wrong piece count and history leading to another position
+        results.push_back(Board::deserialize(buffer, size - 1, copy));
+        buffer[3 + 2] = 0b10;
+        results.push_back(Board::deserialize(buffer, size, copy));
+        buffer[3 + 2] = 0b11;
+        results.push_back(Board::deserialize(buffer, size, copy));
+        game.serialize(buffer, true);
+        buffer[Board::SERIALIZED_SIZE + 6] = 5;
+        results.push_back(Board::deserialize(buffer, size, copy));
+
+        EQ_TEST(results, (std::vector<int>){0, 0, 0, 0}, "Function deserialize Test 2");
+    }
+
+    { // Function deserialize Test 3
+
+        Board game;
+        for (const auto column : std::string{"4433210"}) game.playMove(column - '0');
+        Board rebuilt{game.getBoard(), game.getPlayerPieces(), game.getCurrentPlayer(), nullptr, game.getNumberOfPlays()};
+
+        // The history of a board built from its bitboards is unknown, the short form is written
+        uint8_t buffer[Board::SERIALIZED_SIZE + 63];
+        Board copy;
+        const auto size{rebuilt.serialize(buffer, true)};
+        const auto read{Board::deserialize(buffer, size, copy)};
+
+        EQ_TEST((std::vector<int>){size, read, copy.getBoardKey() == game.getBoardKey()},
+            (std::vector<int>){Board::SERIALIZED_SIZE, Board::SERIALIZED_SIZE, true}, "Function deserialize Test 3");
+    }
+
+    { // Function getHash Test
+
+        Board game, transposition, rebuilt;
+        for (const auto column : std::string{"4433210"}) game.playMove(column - '0');
+        for (const auto column : std::string{"3344210"}) transposition.playMove(column - '0');
+
+        // The hash of a board rebuilt from its bitboards matches the incremental one
+        uint8_t buffer[Board::SERIALIZED_SIZE];
+        Board::deserialize(buffer, game.serialize(buffer), rebuilt);
+
+        // Undoing a move restores the previous hash
+        const auto hash{game.getHash()};
+        game.playMove(8);
+        const auto changed{game.getHash() != hash};
+        game.undoLastMove();
+
+        EQ_TEST((std::vector<bool>){transposition.getHash() == hash, rebuilt.getHash() == hash, changed,
+                game.getHash() == hash, Board().getHash() == 0ULL},
+            (std::vector<bool>){true, true, true, true, true}, "Function getHash Test");
+    }
+
+    { // Function getMirroredHash Test
+
+        Board game, mirror, symmetrical;
+        for (const auto column : std::string{"4433210"}) game.playMove(column - '0');
+        for (const auto column : std::string{"4455678"}) mirror.playMove(column - '0');
+        for (const auto column : std::string{"4048"}) symmetrical.playMove(column - '0');
+
+        EQ_TEST((std::vector<bool>){game.getMirroredHash() == mirror.getHash(), mirror.getMirroredHash() == game.getHash(),
+                game.getCanonicalHash() == mirror.getCanonicalHash(), game.getHash() != mirror.getHash(),
+                symmetrical.getHash() == symmetrical.getMirroredHash(), Board().getMirroredHash() == 0ULL},
+            (std::vector<bool>){true, true, true, true, true, true}, "Function getMirroredHash Test");
+    }
+
 };
@@ -0,0 +1,103 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/solver.hpp"
+#include <cstdio>
+
+void runEndgameDatabaseTests() {
+
+    std::cout << ansi::foreground_yellow << "ENDGAME DATABASE TESTS" << ansi::reset << std::endl;
+
+    { // Function generate Test
+
+        Board game;
+        for (const auto column : std::string{"773452523314200123558107783217015876871040522835803"}) {
+            game.playMove(column - '0');
+        }
+
+        EndgameDatabase database;
+        database.generate(game, 12);
+
+        EQ_TEST((std::vector<uint64_t>){database.getPositionsNum(), (uint64_t)database.probe(game)},
+            (std::vector<uint64_t>){1286ULL, (uint64_t)EndgameDatabase::WIN}, "Function generate Test");
+    }
+
+    { // Function covers Test
+
+        Board game;
+        for (const auto column : std::string{"773452523314200123558107783217015876871040522835803"}) {
+            game.playMove(column - '0');
+        }
+
+        EndgameDatabase database;
+        database.generate(game, 8);
+
+        const auto root_covered{database.covers(game)};
+        game.playMove(1);
+        game.playMove(4);
+        game.playMove(6);
+        const auto child_covered{database.covers(game)};
+        game.playMove(8);
+        const auto late_child_covered{database.covers(game)};
+
+        // Same number of pieces, but not below the root
+        Board other_game;
+        for (const auto column : std::string{"1134287712832744464530864466018651622871755578153730086"}) {
+            other_game.playMove(column - '0');
+        }
+
+        EQ_TEST((std::vector<bool>){root_covered, child_covered, late_child_covered, database.covers(other_game)},
+            (std::vector<bool>){false, false, true, false}, "Function covers Test");
+    }
+
+    { // Function probe Test
+
+        Board game;
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+
+        EndgameDatabase database;
+        database.generate(game, 14);
+
+        // The search starts below positions where the player to move could win at once
+        for (const auto column : std::string{"37763372"}) {
+            game.playMove(column - '0');
+        }
+
+        Solver solver;
+        const auto score{solver.solve(game)};
+        solver.reset();
+        solver.setEndgameDatabase(&database);
+
+        EQ_TEST((std::vector<int>){score, solver.solve(game)}, (std::vector<int>){3, 3}, "Function probe Test");
+    }
+
+    { // Function save Test
+
+        Board game;
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+
+        EndgameDatabase database;
+        database.generate(game, 14);
+        const auto saved{database.save("endgame_database_test.bin")};
+
+        EndgameDatabase loaded_database;
+        const auto loaded{loaded_database.load("endgame_database_test.bin")};
+        std::remove("endgame_database_test.bin");
+
+        // The solver gets the same score with fewer nodes
+        Solver solver;
+        const auto score{solver.solve(game)};
+        const auto nodes{solver.getNodeCount()};
+        solver.reset();
+        solver.setEndgameDatabase(&loaded_database);
+        const auto database_score{solver.solve(game)};
+
+        EQ_TEST((std::vector<bool>){saved, loaded, loaded_database.getPositionsNum() == database.getPositionsNum(),
+                database_score == score, solver.getNodeCount() < nodes},
+            (std::vector<bool>){true, true, true, true, true}, "Function save Test");
+    }
+
+};
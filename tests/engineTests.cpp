@@ -0,0 +1,134 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/engine.hpp"
+#include <cstdio>
+
+void runEngineTests() {
+
+    std::cout << ansi::foreground_yellow << "ENGINE TESTS" << ansi::reset << std::endl;
+
+    const auto later{std::chrono::steady_clock::now() + std::chrono::seconds(60)};
+
+    { // Function parseGrid Test
+
+        Board game;
+        for (const auto column : std::string{"44332"}) game.playMove(column - '0');
+
+        const std::vector<std::string> rows{".........", ".........", ".........", ".........", ".........",
+            "...11....", "..000...."};
+        Board grid, invalid;
+        const auto parsed{Engine::parseGrid(rows, '1', grid)};
+
+        // A piece above an empty cell
+        const std::vector<std::string> floating{".........", ".........", ".........", ".........", "...11....",
+            ".........", "..000...."};
+        const auto parsed_floating{Engine::parseGrid(floating, '1', invalid)};
+
+        EQ_TEST((std::vector<int>){parsed, grid.getBoardKey() == game.getBoardKey(), parsed_floating},
+            (std::vector<int>){true, true, false}, "Function parseGrid Test");
+    }
+
+    { // Function chooseMove Test 1
+
+        Engine engine;
+        for (const auto column : std::string{"404040"}) engine.playMove(column - '0');
+
+        const auto move{engine.chooseMove(later)};
+
+        // The first player wins in the column 4
+        EQ_TEST((std::vector<int>){move.column, move.source, move.score},
+            (std::vector<int>){4, Engine::WINNING, 29}, "Function chooseMove Test 1");
+    }
+
+    { // Function chooseMove Test 2
+
+        Engine engine;
+        for (const auto column : std::string{"40404"}) engine.playMove(column - '0');
+
+        const auto move{engine.chooseMove(later)};
+
+        // The second player must block the column 4
+        EQ_TEST((std::vector<int>){move.column, move.source}, (std::vector<int>){4, Engine::FORCED},
+            "Function chooseMove Test 2");
+    }
+
+    { // Function chooseMove Test 3
+
+        Engine engine;
+        Board game;
+        Solver solver;
+        for (const auto column : std::string{"773452523314200123558107783217015876871040522835803"}) {
+            engine.playMove(column - '0');
+            game.playMove(column - '0');
+        }
+
+        const auto move{engine.chooseMove(later)};
+        game.playMove(move.column);
+
+        // The solved move keeps the score of the position
+        EQ_TEST((std::vector<int>){move.source, -solver.solve(game)}, (std::vector<int>){Engine::SOLVED, move.score},
+            "Function chooseMove Test 3");
+    }
+
+    { // Function chooseMove Test 4
+
+        Engine engine;
+        const auto move{engine.chooseMove(std::chrono::steady_clock::now())};
+
+        // The empty board cannot be solved in time
+        EQ_TEST((std::vector<int>){move.column, move.source}, (std::vector<int>){4, Engine::HEURISTIC},
+            "Function chooseMove Test 4");
+    }
+
+    { // Function setProofNumberLimit Test
+
+        Engine engine;
+        for (const auto column : std::string{"20838556400188067235002045"}) engine.playMove(column - '0');
+        engine.setProofNumberLimit(100000ULL);
+
+        const auto move{engine.chooseMove(later)};
+
+        // The pre-check proves the win before the solver runs
+        EQ_TEST((std::vector<int>){move.column, move.source}, (std::vector<int>){3, Engine::PROVEN},
+            "Function setProofNumberLimit Test");
+    }
+
+    { // Function loadBook Test
+
+        // The book plays the column 1 after 7 and, by symmetry, the column 7 after 1
+        Board game;
+        game.playMove(7);
+        PositionArrayWriter writer;
+        writer.open("engine_book_test.bin");
+        writer.add(Engine::makeBookEntry(game, 1));
+        writer.close();
+
+        Engine engine;
+        const auto loaded{engine.loadBook("engine_book_test.bin")};
+        engine.playMove(1);
+        const auto move{engine.chooseMove(later)};
+        std::remove("engine_book_test.bin");
+
+        EQ_TEST((std::vector<int>){loaded, (int)engine.getBookSize(), move.column, move.source},
+            (std::vector<int>){true, 1, 7, Engine::BOOK}, "Function loadBook Test");
+    }
+
+    { // Function steal Test
+
+        Engine engine, stolen;
+        engine.playMove(4);
+        stolen.playMove(4);
+        const auto should_steal{engine.shouldSteal()};
+        stolen.steal();
+
+        Engine border;
+        border.playMove(0);
+
+        // The pieces stay in place and the other player moves
+        EQ_TEST((std::vector<int>){should_steal, border.shouldSteal(),
+                stolen.getBoard().getBoardKey() == engine.getBoard().getBoardKey(),
+                stolen.getBoard().getCurrentPlayer() != engine.getBoard().getCurrentPlayer()},
+            (std::vector<int>){true, false, true, true}, "Function steal Test");
+    }
+
+};
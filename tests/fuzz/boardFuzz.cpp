@@ -0,0 +1,271 @@
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/board.hpp"
+
+constexpr auto ROWS_NUM{7}; // Number of playable rows
+constexpr auto COLS_NUM{9}; // Number of columns
+constexpr auto CELLS_NUM{ROWS_NUM * COLS_NUM}; // Number of playable cells
+constexpr uint64_t KEY_SLOTS{(1ULL << 18) - 5ULL}; // Number of slots of the key collision table of every thread
+
+/**
+ * @brief A naive board with one cell per array element, used as the reference of the bitboards.
+ */
+struct ReferenceBoard {
+    int cells[COLS_NUM][ROWS_NUM]{}; // 0 for an empty cell, 1 for the first player, 2 for the second one
+    int heights[COLS_NUM]{}; // Number of pieces of every column
+    int history[CELLS_NUM]{}; // The played columns
+    int plays{0}; // Number of plays
+
+    bool isValid(const int &column) const {return heights[column] < ROWS_NUM;}
+
+    void play(const int &column) {
+        cells[column][heights[column]++] = 1 + plays % 2;
+        history[plays++] = column;
+    }
+
+    void undo() {
+        const auto column{history[--plays]};
+        cells[column][--heights[column]] = 0;
+    }
+
+    /**
+     * @brief Check if the last move made a line of four, looking at every line through it.
+     */
+    bool lastMoveWins() const {
+        if (plays == 0) return false;
+        const auto column{history[plays - 1]};
+        const auto row{heights[column] - 1};
+        const auto player{cells[column][row]};
+        const int directions[4][2]{{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+        for (const auto &direction : directions) {
+            auto count{1};
+            for (const auto sign : {1, -1}) {
+                auto c{column + sign * direction[0]};
+                auto r{row + sign * direction[1]};
+                while (0 <= c && c < COLS_NUM && 0 <= r && r < ROWS_NUM && cells[c][r] == player) {
+                    count++;
+                    c += sign * direction[0];
+                    r += sign * direction[1];
+                }
+            }
+            if (count >= 4) return true;
+        }
+        return false;
+    }
+
+    int validMask() const {
+        auto mask{0};
+        for (int column{0}; column < COLS_NUM; column++) if (isValid(column)) mask |= 1 << column;
+        return mask;
+    }
+
+    int winningMask() {
+        auto mask{0};
+        for (int column{0}; column < COLS_NUM; column++) {
+            if (!isValid(column)) continue;
+            play(column);
+            if (lastMoveWins()) mask |= 1 << column;
+            undo();
+        }
+        return mask;
+    }
+
+    /**
+     * @brief Encode the grid from the point of view of the player to move (2 bits per cell).
+     */
+    std::pair<uint64_t, uint64_t> encode() const {
+        std::pair<uint64_t, uint64_t> code{0ULL, 0ULL};
+        const auto current{1 + plays % 2};
+        for (int column{0}; column < COLS_NUM; column++) {
+            for (int row{0}; row < ROWS_NUM; row++) {
+                const auto cell{cells[column][row] == 0 ? 0ULL : cells[column][row] == current ? 1ULL : 2ULL};
+                const auto idx{column * ROWS_NUM + row};
+                if (idx < 32) code.first |= cell << (2 * idx);
+                else code.second |= cell << (2 * (idx - 32));
+            }
+        }
+        return code;
+    }
+
+    /**
+     * @brief Build the bitboards of the grid, or of its mirror image, and the board they describe.
+     */
+    Board toBoard(const bool &mirrored) const {
+        const auto current{1 + plays % 2};
+        uint128_t board_bits{0ULL}, player_bits{0ULL};
+        for (int column{0}; column < COLS_NUM; column++) {
+            const auto target{mirrored ? COLS_NUM - 1 - column : column};
+            for (int row{0}; row < heights[column]; row++) {
+                const auto cell{(uint128_t)1ULL << (target * (ROWS_NUM + 1) + row)};
+                board_bits |= cell;
+                if (cells[column][row] == current) player_bits |= cell;
+            }
+        }
+        return Board{board_bits, player_bits, plays % 2 == 0, nullptr, plays};
+    }
+};
+
+/**
+ * @brief A slot of the key collision table: a board key and the grid it was computed from.
+ */
+struct KeySlot {
+    std::pair<uint64_t, uint64_t> key{0ULL, 0ULL}; // The board key (zero for an empty slot)
+    std::pair<uint64_t, uint64_t> grid{0ULL, 0ULL}; // The encoded reference grid
+    uint64_t hash{0ULL}; // The Zobrist hash of the board
+};
+
+/**
+ * @brief Small and fast random generator (xorshift64*).
+ */
+static uint64_t nextRandom(uint64_t &state) {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief Report a mismatch between the bitboards and the reference board, with the moves that lead to it.
+ */
+static std::string fail(const std::string &what, const ReferenceBoard &reference, const uint64_t &game) {
+    std::string message{"Mismatch in " + what + " (game " + std::to_string(game) + ", moves "};
+    for (int play{0}; play < reference.plays; play++) message += (char)('0' + reference.history[play]);
+    return message + ")";
+}
+
+/**
+ * @brief Play random games and check every position against the reference board.
+ * @param first The index of the first game.
+ * @param last The index past the last game.
+ * @param seed The seed of the random moves.
+ * @param positions The number of checked positions, updated by the function.
+ * @return An empty string if there was no mismatch, otherwise the description of the first one.
+ */
+static std::string fuzzGames(const uint64_t &first, const uint64_t &last, uint64_t state, uint64_t &positions) {
+    if (state == 0ULL) state = 1ULL;
+
+    // Direct-mapped table of the recent keys (the keys are never zero because of the bottom line)
+    std::vector<KeySlot> keys(KEY_SLOTS);
+    uint128_t key_history[CELLS_NUM + 1];
+    uint64_t hash_history[CELLS_NUM + 1];
+
+    for (uint64_t game{first}; game < last; game++) {
+        Board board;
+        ReferenceBoard reference;
+        key_history[0] = board.getBoardKey();
+        hash_history[0] = board.getHash();
+
+        while (true) {
+            positions++;
+            if (board.getValidPositions() != reference.validMask()) return fail("getValidPositions", reference, game);
+            const auto winning{reference.winningMask()};
+            if (board.getWinningPositions() != winning) return fail("getWinningPositions", reference, game);
+            if (board.canWinNext() != (winning != 0)) return fail("canWinNext", reference, game);
+
+            // Equal keys must come from equal grids
+            const auto key{board.getBoardKey()};
+            const std::pair<uint64_t, uint64_t> key_code{(uint64_t)(key >> 64), (uint64_t)key};
+            const auto grid{reference.encode()};
+            auto &slot{keys[(key_code.second * 0x9E3779B97F4A7C15ULL ^ key_code.first) % KEY_SLOTS]};
+            if (slot.key == key_code && slot.grid != grid) return fail("getBoardKey", reference, game);
+            if (slot.key == key_code && slot.hash != board.getHash()) return fail("getHash", reference, game);
+            slot.key = key_code;
+            slot.grid = grid;
+            slot.hash = board.getHash();
+
+            // The incremental hashes must match the ones computed from the grid and from its mirror image
+            if ((positions & 15ULL) == 0ULL) {
+                if (reference.toBoard(false).getHash() != board.getHash()) return fail("getHash", reference, game);
+                if (reference.toBoard(true).getHash() != board.getMirroredHash()) {
+                    return fail("getMirroredHash", reference, game);
+                }
+            }
+
+            // Play a random valid column
+            const auto valid{reference.validMask()};
+            auto choice{(int)(nextRandom(state) % __builtin_popcount(valid))};
+            auto column{0};
+            for (; column < COLS_NUM; column++) {
+                if ((valid & (1 << column)) != 0 && choice-- == 0) break;
+            }
+            board.playMove(column);
+            reference.play(column);
+            key_history[reference.plays] = board.getBoardKey();
+            hash_history[reference.plays] = board.getHash();
+
+            // Undo and replay the move from time to time
+            if ((nextRandom(state) & 7ULL) == 0ULL) {
+                board.undoLastMove();
+                if (board.getBoardKey() != key_history[reference.plays - 1]) return fail("undoLastMove", reference, game);
+                if (board.getHash() != hash_history[reference.plays - 1]) return fail("undoLastMove", reference, game);
+                board.playMove(column);
+                if (board.getBoardKey() != key_history[reference.plays]) return fail("playMove", reference, game);
+                if (board.getHash() != hash_history[reference.plays]) return fail("playMove", reference, game);
+            }
+
+            const auto win{reference.lastMoveWins()};
+            if (board.checkLastPlayerWin() != win) return fail("checkLastPlayerWin", reference, game);
+            if (win) break;
+            if (board.checkFinishDraw() != (reference.plays == CELLS_NUM)) return fail("checkFinishDraw", reference, game);
+            if (reference.plays == CELLS_NUM) break;
+        }
+
+        // Undo the whole game
+        while (reference.plays > 0) {
+            board.undoLastMove();
+            reference.undo();
+            if (board.getBoardKey() != key_history[reference.plays]) return fail("undoLastMove", reference, game);
+            if (board.getHash() != hash_history[reference.plays]) return fail("undoLastMove", reference, game);
+        }
+        if (board.getNumberOfPlays() != 0) return fail("getNumberOfPlays", reference, game);
+    }
+
+    return std::string{};
+}
+
+/**
+ * Differential fuzzing of the Board class against a naive 2D board.
+ * Plays random games and checks every position: the valid and winning columns, the win of the last move, the
+ * uniqueness of the board keys, the incremental and mirrored hashes (against boards rebuilt from the grid and from its
+ * mirror image) and the undo of the moves, back to the empty board at the end of every game.
+ * The games are split between the threads, each one with its own random moves.
+ * Usage: connect4_fuzz.exe [games] [seed] [threads]
+ */
+int main(int argc, char *argv[]) {
+    const uint64_t games{argc > 1 ? std::stoull(argv[1]) : 1000000ULL};
+    const uint64_t seed{argc > 2 ? std::stoull(argv[2]) : 0x1234567890ABCDEFULL};
+    const int threads_num = argc > 3 ? std::stoi(argv[3]) : std::max(1U, std::thread::hardware_concurrency());
+
+    std::vector<std::string> failures(threads_num);
+    std::vector<uint64_t> positions(threads_num, 0ULL);
+    std::vector<std::thread> threads;
+
+    const auto start{std::chrono::steady_clock::now()};
+    for (int thread{0}; thread < threads_num; thread++) {
+        threads.emplace_back([&, thread]() {
+            failures[thread] = fuzzGames(games * thread / threads_num, games * (thread + 1) / threads_num,
+                seed + thread * 0x9E3779B97F4A7C15ULL, positions[thread]);
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    const auto seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    for (const auto &failure : failures) {
+        if (failure.empty()) continue;
+        std::cerr << failure << std::endl;
+        return 1;
+    }
+
+    uint64_t total_positions{0ULL};
+    for (const auto count : positions) total_positions += count;
+    std::cout << "Games: " << games << " (" << total_positions << " positions) without mismatch" << std::endl;
+    std::cout << "Time: " << seconds << " s with " << threads_num << " threads (" << games / seconds << " games/s, "
+        << total_positions / seconds << " positions/s)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/gameRecord.hpp"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+void runGameRecordTests() {
+
+    std::cout << ansi::foreground_yellow << "GAME RECORD TESTS" << ansi::reset << std::endl;
+
+    { // Function replayGame Test
+
+        const std::vector<std::string> games{"8080808", "80808010", "4", "80808080", "9", "4444444"};
+        std::vector<int> results;
+        for (const auto &game : games) {
+            Board board;
+            results.push_back(GameRecordReader::replayGame(game.data(), game.data() + game.size(), board));
+        }
+
+        // The last game fills the column 4 without any line of four
+        EQ_TEST(results, (std::vector<int>){GameRecordReader::FIRST_PLAYER_WIN, GameRecordReader::SECOND_PLAYER_WIN,
+                GameRecordReader::UNFINISHED, GameRecordReader::INVALID, GameRecordReader::INVALID,
+                GameRecordReader::UNFINISHED}, "Function replayGame Test");
+    }
+
+    { // Function replay Test
+
+        {
+            std::ofstream file("game_record_test.txt", std::ios::binary);
+            file << "8080808\n80808010\r\n\n4\n80808080\n9\n44444445\n";
+            for (int repetitions = 0; repetitions < 20; repetitions++) {
+                file << "012345678012345678\n";
+            }
+        }
+
+        GameRecordReader reader;
+        const auto opened{reader.open("game_record_test.txt")};
+
+        // Small chunks so that many lines cross the chunk boundaries
+        std::atomic<uint64_t> records{0ULL};
+        std::atomic<uint64_t> first_moves{0ULL};
+        const auto stats{reader.replay(3, [&](const int, const PositionRecord &record) {
+            records++;
+            if (record.ply == 0 && record.column == 8) first_moves++;
+        }, 5)};
+        reader.close();
+        std::remove("game_record_test.txt");
+
+        EQ_TEST((std::vector<uint64_t>){(uint64_t)opened, stats.games, stats.invalid_games, stats.first_player_wins,
+                stats.second_player_wins, stats.unfinished_games, stats.positions, records.load(), first_moves.load()},
+            (std::vector<uint64_t>){1ULL, 26ULL, 2ULL, 1ULL, 1ULL, 22ULL, 7ULL + 8ULL + 1ULL + 8ULL + 20ULL * 18ULL,
+                7ULL + 8ULL + 1ULL + 8ULL + 20ULL * 18ULL, 2ULL}, "Function replay Test");
+    }
+
+};
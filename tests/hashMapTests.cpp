@@ -2,6 +2,42 @@
 #include "../runTests.hpp"
 #include "../src/hashMap.hpp"
 
+/**
+ * @brief An entry with a search depth, to test the entry and replace policies of a HashMap.
+ */
+struct DepthEntry {
+    using Value = uint16_t;
+
+    static constexpr Value EMPTY{0};
+
+    uint64_t key : 40;
+    uint64_t depth : 8;
+    uint64_t value : 16;
+
+    DepthEntry()
+        : key(0ULL), depth(0ULL), value(EMPTY) {};
+
+    DepthEntry(const uint64_t &theKey, const Value &theValue)
+        : key(theKey), depth(theValue >> 8), value(theValue) {};
+
+    bool matches(const uint64_t &theKey) const {
+        return key == (theKey & ((1ULL << 40) - 1ULL));
+    }
+
+    Value getValue() const {
+        return (Value) value;
+    }
+};
+
+/**
+ * @brief Replace policy keeping the deeper entry of the same index.
+ */
+struct DeeperReplace {
+    static bool shouldReplace(const DepthEntry &stored, const DepthEntry &entry) {
+        return entry.depth >= stored.depth;
+    }
+};
+
 void runHashMapTests() {
 
     std::cout << ansi::foreground_yellow << "HASHMAP TESTS" << ansi::reset << std::endl;
@@ -29,4 +65,118 @@ void runHashMapTests() {
             (std::vector<uint8_t>){value, 222}, "Function Put Test 1");
     }
 
+    { // Function Put Test 2
+
+        HashMap<uint128_t> map;
+        uint128_t key1{255ULL, 3ULL};
+        uint128_t key2{0ULL, 3ULL};
+
+        uint8_t value = 7;
+
+        map.put(key1, value);
+
+        EQ_TEST((std::vector<uint8_t>){map.get(key1), map.get(key2)},
+            (std::vector<uint8_t>){value, 222}, "Function Put Test 2");
+    }
+
+    { // Function Put Test 3
+
+        HashMap map;
+        auto key = 0xFEDCBA9876543210ULL;
+
+        uint8_t value = 9;
+
+        // Only the 56 least significant bits of the key are stored
+        map.put(key, value);
+
+        EQ_TEST(map.get(key), value, "Function Put Test 3");
+    }
+
+    { // Function clear Test
+
+        HashMap map;
+        auto key = 3ULL;
+
+        uint8_t value = 5;
+
+        map.put(key, value);
+        map.clear();
+
+        EQ_TEST(map.get(key), (uint8_t)222, "Function clear Test");
+    }
+
+    { // Copy Constructor Test
+
+        HashMap first{1021};
+        first.put(3ULL, 5);
+
+        HashMap second{first};
+        second.put(4ULL, 6);
+        first.put(3ULL, 7);
+
+        // The copy keeps the size and the entries, and is independent of the original
+        EQ_TEST((std::vector<uint32_t>){second.getSize(), second.get(3ULL), second.get(4ULL), first.get(4ULL)},
+            (std::vector<uint32_t>){1021, 5, 6, 222}, "Copy Constructor Test");
+    }
+
+    { // Custom Entry Test
+
+        HashMap<uint64_t, DepthEntry, ModuloIndex, DeeperReplace> map{1021};
+        const auto key1{5ULL};
+        const auto key2{5ULL + 1021ULL};
+        const auto key3{5ULL + 2 * 1021ULL};
+
+        // The depth is the high byte of the value, and a shallower entry does not replace a deeper one
+        map.put(key1, 0x0A01);
+        map.put(key2, 0x0302);
+        const auto kept{map.get(key1)};
+        map.put(key3, 0x0B03);
+
+        EQ_TEST((std::vector<uint16_t>){(uint16_t)sizeof(DepthEntry), kept, map.get(key2), map.get(key1), map.get(key3)},
+            (std::vector<uint16_t>){8, 0x0A01, 0, 0, 0x0B03}, "Custom Entry Test");
+    }
+
+    { // RangeIndex Test
+
+        HashMap<uint64_t, ValueEntry, RangeIndex> map{1000};
+        const auto key1{0x0000000100000003ULL};
+        const auto key2{0xFFFFFFFF00000004ULL};
+
+        map.put(key1, 5);
+        map.put(key2, 6);
+
+        // The high bits pick the index, so both keys fall at the ends of the table
+        EQ_TEST((std::vector<uint32_t>){RangeIndex::calculateIndex(key1, 1000), RangeIndex::calculateIndex(key2, 1000),
+            map.get(key1), map.get(key2), map.get(3ULL)},
+            (std::vector<uint32_t>){0, 999, 5, 6, 222}, "RangeIndex Test");
+    }
+
+    { // Function attachShared Test
+
+        HashMap<>::removeShared("/connect4_hash_map_test");
+
+        uint8_t values[4];
+        {
+            HashMap first{1021}, second;
+            const auto attached{first.attachShared("/connect4_hash_map_test") &&
+                second.attachShared("/connect4_hash_map_test")};
+
+            // The second map takes the size of the segment, and both see the entries of the other
+            first.put(3ULL, 5);
+            second.put(4ULL, 6);
+            values[0] = attached && first.isShared() && second.getSize() == 1021;
+            values[1] = second.get(3ULL);
+            values[2] = first.get(4ULL);
+        }
+
+        // The entries outlive the processes attached to the segment until it is removed
+        HashMap third;
+        third.attachShared("/connect4_hash_map_test");
+        values[3] = third.get(3ULL);
+        const auto removed{HashMap<>::removeShared("/connect4_hash_map_test")};
+
+        EQ_TEST((std::vector<uint8_t>){values[0], values[1], values[2], values[3], removed},
+            (std::vector<uint8_t>){1, 5, 6, 5, 1}, "Function attachShared Test");
+    }
+
 };
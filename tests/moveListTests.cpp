@@ -0,0 +1,30 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/moveList.hpp"
+
+void runMoveListTests() {
+
+    std::cout << ansi::foreground_yellow << "MOVELIST TESTS" << ansi::reset << std::endl;
+
+    { // Constructor Test
+
+        MoveList moves;
+
+        EQ_TEST(moves.size(), 0, "Constructor Test");
+    }
+
+    { // Function add Test
+
+        MoveList moves;
+        moves.add(4, 1);
+        moves.add(3, 2);
+        moves.add(5, 1);
+        moves.add(2, 0);
+        moves.add(6, 3);
+
+        std::vector<int> columns(moves.begin(), moves.end());
+
+        EQ_TEST(columns, (std::vector<int>){6, 3, 4, 5, 2}, "Function add Test");
+    }
+
+};
@@ -0,0 +1,68 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/multiProcessSolver.hpp"
+#include "../src/solver.hpp"
+#include <csignal>
+
+void runMultiProcessSolverTests() {
+
+    std::cout << ansi::foreground_yellow << "MULTI PROCESS SOLVER TESTS" << ansi::reset << std::endl;
+
+    { // Function solveMultiProcess Test 1
+
+        Board game;
+        for (const auto column : std::string{"7211540324713180473658647567338514516"}) game.playMove(column - '0');
+
+        MultiProcessSettings settings;
+        settings.split_depth = 2;
+        settings.table_size = (1U << 19) - 1U;
+        settings.table_name = "/connect4_solver_test";
+        const auto result{solveMultiProcess(game, settings)};
+
+        // The best move keeps the score of the position
+        Solver solver;
+        game.playMove(result.best_move);
+        const auto best_score{-solver.solve(game)};
+
+        EQ_TEST((std::vector<int>){result.solved, result.score, best_score, result.crashes, result.subtrees > 9},
+            (std::vector<int>){true, 3, 3, 0, true}, "Function solveMultiProcess Test 1");
+    }
+
+    { // Function solveMultiProcess Test 2
+
+        Board game;
+        for (const auto column : std::string{"7211540324713180473658647567338514516"}) game.playMove(column - '0');
+
+        // The worker of the first subtree crashes, and the subtree is solved by another one
+        MultiProcessSettings settings;
+        settings.table_size = (1U << 19) - 1U;
+        settings.table_name = "/connect4_solver_test";
+        settings.on_subtree = [](const int &subtree, const int &attempt) {
+            if (subtree == 0 && attempt == 0) raise(SIGKILL);
+        };
+        const auto result{solveMultiProcess(game, settings)};
+
+        EQ_TEST((std::vector<int>){result.solved, result.score, result.crashes},
+            (std::vector<int>){true, 3, 1}, "Function solveMultiProcess Test 2");
+    }
+
+    { // Function solveMultiProcess Test 3
+
+        Board game;
+        for (const auto column : std::string{"7211540324713180473658647567338514516"}) game.playMove(column - '0');
+
+        // The subtree is not handed out again after as many crashes as attempts
+        MultiProcessSettings settings;
+        settings.table_size = (1U << 19) - 1U;
+        settings.table_name = "/connect4_solver_test";
+        settings.max_attempts = 1;
+        settings.on_subtree = [](const int &subtree, const int &) {
+            if (subtree == 0) raise(SIGKILL);
+        };
+        const auto result{solveMultiProcess(game, settings)};
+
+        EQ_TEST((std::vector<int>){result.solved, result.crashes},
+            (std::vector<int>){false, 1}, "Function solveMultiProcess Test 3");
+    }
+
+}
@@ -0,0 +1,120 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/positionArray.hpp"
+#include <algorithm>
+#include <cstdio>
+
+void runPositionArrayTests() {
+
+    std::cout << ansi::foreground_yellow << "POSITION ARRAY TESTS" << ansi::reset << std::endl;
+
+    { // Function unpackPosition Test
+
+        Board game;
+        for (const auto column : std::string{"44332108"}) game.playMove(column - '0');
+
+        const auto position{packPosition(game, -5)};
+        Board copy;
+        const auto unpacked{unpackPosition(position, copy)};
+
+        EQ_TEST((std::vector<int>){unpacked, copy.getBoardKey() == game.getBoardKey(), copy.getNumberOfPlays(),
+                copy.getCurrentPlayer() == game.getCurrentPlayer(), position.label, position.board_head},
+            (std::vector<int>){true, true, 8, true, -5, 1}, "Function unpackPosition Test 1");
+    }
+
+    { // Function unpackPosition Test 2
+
+        Board game;
+        for (const auto column : std::string{"44332108"}) game.playMove(column - '0');
+        const auto position{packPosition(game)};
+
+        // Corrupt records: too many plays, a floating piece, a wrong piece count and an unknown flag
+        std::vector<PackedPosition> corrupt(4, position);
+        corrupt[0].plays = 200;
+        corrupt[1].board_tail |= 1ULL << 5;
+        corrupt[2].player_tail ^= 2ULL << (8 * 4);
+        corrupt[3].flags |= 4;
+
+        Board copy;
+        std::vector<int> unpacked;
+        for (const auto &record : corrupt) unpacked.push_back(unpackPosition(record, copy));
+
+        EQ_TEST((std::vector<int>){unpacked[0], unpacked[1], unpacked[2], unpacked[3], copy.getNumberOfPlays()},
+            (std::vector<int>){false, false, false, false, 0}, "Function unpackPosition Test 2");
+    }
+
+    { // Function open Test
+
+        const std::vector<std::string> games{"", "4", "44332108", "012345678012345678"};
+        PositionArrayWriter writer;
+        const auto created{writer.open("position_array_test.bin")};
+        for (int idx{0}; idx < (int)games.size(); idx++) {
+            Board game;
+            for (const auto column : games[idx]) game.playMove(column - '0');
+            writer.add(packPosition(game, (int16_t)idx));
+        }
+        const auto written{writer.close()};
+
+        PositionArray positions;
+        const auto opened{positions.open("position_array_test.bin")};
+        std::vector<int> plays;
+        for (const auto &position : positions) {
+            Board game;
+            unpackPosition(position, game);
+            plays.push_back(game.getNumberOfPlays());
+        }
+        const int label = positions[3].label;
+        positions.close();
+        std::remove("position_array_test.bin");
+
+        EQ_TEST((std::vector<int>){created, written, opened, (int)positions.getSize(), label, plays[0], plays[1],
+                plays[2], plays[3]}, (std::vector<int>){true, true, true, 0, 3, 0, 1, 8, 18}, "Function open Test");
+    }
+
+    { // Function open Test 2
+
+        {
+            std::ofstream file("position_array_test.bin", std::ios::binary);
+            file << "C4PB and some bytes that are not a header";
+        }
+
+        PositionArray positions;
+        const auto opened{positions.open("position_array_test.bin")};
+        const auto missing{positions.open("missing_position_array_test.bin")};
+        std::remove("position_array_test.bin");
+
+        EQ_TEST((std::vector<int>){opened, missing}, (std::vector<int>){false, false}, "Function open Test 2");
+    }
+
+    { // Function find Test
+
+        Board game, mirrored_game;
+        for (const auto column : std::string{"0123"}) game.playMove(column - '0');
+        for (const auto column : std::string{"8765"}) mirrored_game.playMove(column - '0');
+
+        std::vector<PackedPosition> positions;
+        for (const auto &moves : {"", "4", "0123", "44", "17"}) {
+            Board board;
+            for (const auto column : std::string{moves}) board.playMove(column - '0');
+            positions.push_back(packPosition(board));
+        }
+        std::sort(positions.begin(), positions.end(), comparePositions);
+
+        PositionArrayWriter writer;
+        writer.open("position_array_test.bin");
+        for (const auto &position : positions) writer.add(position);
+        writer.close();
+
+        PositionArray array;
+        array.open("position_array_test.bin");
+        const auto found{array.find(packPosition(game)) != nullptr};
+        const auto found_mirrored{array.find(packPosition(mirrored_game)) != nullptr};
+        const auto found_mirror{array.find(mirrorPosition(packPosition(mirrored_game))) != nullptr};
+        array.close();
+        std::remove("position_array_test.bin");
+
+        EQ_TEST((std::vector<int>){found, found_mirrored, found_mirror}, (std::vector<int>){true, false, true},
+            "Function find Test");
+    }
+
+};
@@ -0,0 +1,107 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/proofNumberSearch.hpp"
+#include <atomic>
+#include <chrono>
+
+void runProofNumberSearchTests() {
+
+    std::cout << ansi::foreground_yellow << "PROOF NUMBER SEARCH TESTS" << ansi::reset << std::endl;
+
+    { // Function search Test
+
+        Board game;
+        ProofNumberSearch prover;
+
+        // A sharp position with a forced win that alpha-beta needs hundreds of thousands of nodes to find
+        for (const auto column : std::string{"20838556400188067235002045"}) game.playMove(column - '0');
+
+        const auto board_key{game.getBoardKey()};
+        const auto result{prover.search(game, 100000ULL)};
+
+        EQ_TEST((std::vector<int>){result, prover.getProvingMove(), game.getBoardKey() == board_key},
+            (std::vector<int>){ProofNumberSearch::PROVEN, 3, true}, "Function search Test");
+    }
+
+    { // Function search Test 2
+
+        Board game;
+        ProofNumberSearch prover;
+
+        // The current player loses with the best play (score -7)
+        for (const auto column : std::string{"07303855474655827513218544572"}) game.playMove(column - '0');
+
+        const auto result{prover.search(game, 1000000ULL)};
+
+        EQ_TEST((std::vector<int>){result, prover.getProvingMove()},
+            (std::vector<int>){ProofNumberSearch::DISPROVEN, -1}, "Function search Test 2");
+    }
+
+    { // Function search Test 3
+
+        Board game;
+        ProofNumberSearch prover, small_prover{1024ULL};
+
+        for (const auto column : std::string{"76163118557561021177316040"}) game.playMove(column - '0');
+
+        // The node limit stops the search, a tiny node table only makes it slower
+        const auto limited{prover.search(game, 10ULL)};
+        const auto limited_nodes{prover.getNodeCount()};
+        const auto small{small_prover.search(game, 1000000ULL)};
+
+        EQ_TEST((std::vector<int>){limited, limited_nodes < 100ULL, small, small_prover.getProvingMove()},
+            (std::vector<int>){ProofNumberSearch::UNKNOWN, true, ProofNumberSearch::PROVEN, 6}, "Function search Test 3");
+    }
+
+    { // Function search Test 4
+
+        Board game;
+        ProofNumberSearch prover{4096ULL};
+
+        for (const auto column : std::string{"20838556400188067235002045"}) game.playMove(column - '0');
+        const auto first{prover.search(game, 1000000ULL)};
+        const auto first_move{prover.getProvingMove()};
+
+        // The searches of the grandchildren replace the entries of the children, but not the one of the proved root
+        for (int column{0}; column < 9; column++) {
+            if (!game.isValidPosition(column)) continue;
+            game.playMove(column);
+            for (int reply{0}; reply < 9; reply++) {
+                if (!game.isValidPosition(reply)) continue;
+                game.playMove(reply);
+                if (!game.checkLastPlayerWin() && !game.checkFinishDraw()) prover.search(game, 20000ULL);
+                game.undoLastMove();
+            }
+            game.undoLastMove();
+        }
+        const auto second{prover.search(game, 1000000ULL)};
+
+        EQ_TEST((std::vector<int>){first, first_move, second, prover.getProvingMove()},
+            (std::vector<int>){ProofNumberSearch::PROVEN, 3, ProofNumberSearch::PROVEN, 3}, "Function search Test 4");
+    }
+
+    { // Function setStopFlag Test
+
+        Board game;
+        for (const auto column : std::string{"7211540324713180473658647567338514516"}) game.playMove(column - '0');
+
+        // A raised flag or a past deadline stops the search at the first check, after 1024 nodes
+        std::atomic<bool> stop{true};
+        ProofNumberSearch flagged, late;
+        flagged.setStopFlag(&stop);
+        late.setDeadline(std::chrono::steady_clock::now());
+        const auto flagged_result{flagged.search(game, 1000000ULL)};
+        const auto flagged_nodes{flagged.getNodeCount()};
+        const auto late_result{late.search(game, 1000000ULL)};
+
+        // The search goes on from where it stopped once the flag is lowered
+        stop = false;
+        const auto resumed{flagged.search(game, 1000000ULL)};
+
+        EQ_TEST((std::vector<int>){flagged_result, (int)flagged_nodes, late_result, (int)late.getNodeCount(),
+                resumed, flagged.getProvingMove()},
+            (std::vector<int>){ProofNumberSearch::UNKNOWN, 1024, ProofNumberSearch::UNKNOWN, 1024,
+                ProofNumberSearch::PROVEN, 6}, "Function setStopFlag Test");
+    }
+
+};
@@ -0,0 +1,131 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/solver.hpp"
+
+void runSolverTests() {
+
+    std::cout << ansi::foreground_yellow << "SOLVER TESTS" << ansi::reset << std::endl;
+
+    { // Function solve Test 1
+
+        Board game;
+        Solver solver;
+
+        for (const auto column : std::string{"328622011158737830052856561751880063655060867411372"}) {
+            game.playMove(column - '0');
+        }
+
+        // The current player wins with the next move
+        EQ_TEST(solver.solve(game), 6, "Function solve Test 1");
+    }
+
+    { // Function solve Test 2
+
+        Board game;
+        Solver solver;
+
+        for (const auto column : std::string{"773452523314200123558107783217015876871040522835803"}) {
+            game.playMove(column - '0');
+        }
+
+        EQ_TEST(solver.solve(game), 2, "Function solve Test 2");
+    }
+
+    { // Function solve Test 3
+
+        Board game;
+        Solver solver;
+
+        for (const auto column : std::string{"113428771283274446453086446601865162287175557815373"}) {
+            game.playMove(column - '0');
+        }
+
+        EQ_TEST(solver.solve(game), -6, "Function solve Test 3");
+    }
+
+    { // Function solveFullWindow Test
+
+        Board game;
+        Solver solver;
+
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+
+        const auto board_key{game.getBoardKey()};
+        const auto null_window_score{solver.solve(game)};
+        solver.reset();
+        const auto full_window_score{solver.solveFullWindow(game)};
+
+        EQ_TEST((std::vector<uint128_t>){(uint128_t)null_window_score, (uint128_t)full_window_score, game.getBoardKey()},
+            (std::vector<uint128_t>){3ULL, 3ULL, board_key}, "Function solveFullWindow Test");
+    }
+
+    { // Function solveWeak Test
+
+        Solver solver;
+        std::vector<int> results;
+
+        // Positions with the scores 6, 2, -6 and 0
+        for (const auto &sequence : {"328622011158737830052856561751880063655060867411372",
+                "773452523314200123558107783217015876871040522835803", "113428771283274446453086446601865162287175557815373",
+                "54366545075343587084675725216216346638078470734301"}) {
+            Board game;
+            for (const auto column : std::string{sequence}) game.playMove(column - '0');
+            results.push_back(solver.solveWeak(game));
+        }
+
+        EQ_TEST(results, (std::vector<int>){1, 1, -1, 0}, "Function solveWeak Test");
+    }
+
+    { // Function solve Test 4
+
+        Board game;
+        Solver solver;
+
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+
+        const auto board_key{game.getBoardKey()};
+        std::vector<int> principal_variation;
+        const auto score{solver.solve(game, principal_variation)};
+
+        // The variation is a valid game that the current player wins with the score
+        Board line{game};
+        auto valid{true};
+        for (const auto column : principal_variation) {
+            valid = valid && !line.checkLastPlayerWin() && line.isValidPosition(column);
+            if (valid) line.playMove(column);
+        }
+        const auto line_score{(Solver::CELLS_NUM + 2 - line.getNumberOfPlays()) / 2};
+
+        EQ_TEST((std::vector<int>){score, valid, line.checkLastPlayerWin(), (int)principal_variation.size() % 2, line_score,
+                game.getBoardKey() == board_key},
+            (std::vector<int>){3, true, true, 1, 3, true}, "Function solve Test 4");
+    }
+
+    { // Function analyze Test
+
+        Board game;
+        Solver solver;
+
+        for (const auto column : std::string{"328622011158737830052856561751880063655"}) {
+            game.playMove(column - '0');
+        }
+
+        // The column 5 is full, the node counts of the moves add up to the total
+        std::vector<int> results;
+        uint64_t nodes{0ULL};
+        for (const auto &move : solver.analyze(game)) {
+            results.push_back(move.column);
+            results.push_back(move.score);
+            nodes += move.nodes;
+        }
+        results.push_back(nodes == solver.getNodeCount());
+
+        EQ_TEST(results, (std::vector<int>){0, -7, 1, -7, 2, 3, 3, 3, 4, -12, 6, -8, 7, -12, 8, -7, true},
+            "Function analyze Test");
+    }
+
+};
@@ -0,0 +1,80 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/positionArray.hpp"
+#include "../src/stateEnumeration.hpp"
+#include <algorithm>
+#include <cstdio>
+
+void runStateEnumerationTests() {
+
+    std::cout << ansi::foreground_yellow << "STATE ENUMERATION TESTS" << ansi::reset << std::endl;
+
+    { // Function enumerateStates Test
+
+        EnumerationSettings settings;
+        settings.max_plies = 6;
+        settings.threads = 2;
+
+        // Counted by a depth-first search over the canonical keys of the positions
+        std::vector<int> states;
+        for (const auto &stats : enumerateStates(settings)) states.push_back((int)stats.states);
+
+        EQ_TEST(states, (std::vector<int>){1, 5, 41, 241, 1385, 6161, 28025}, "Function enumerateStates Test");
+    }
+
+    { // Function enumerateStates Test 2
+
+        EnumerationSettings settings;
+        settings.max_plies = 7;
+        settings.threads = 2;
+        settings.memory_budget = 0ULL;
+
+        // Every partition is spilled to disk as soon as its hash set is full
+        std::vector<int> states;
+        const auto results{enumerateStates(settings)};
+        for (const auto &stats : results) states.push_back((int)stats.states);
+        states.push_back((int)results.back().wins);
+        states.push_back(results.back().runs > 0ULL);
+
+        EQ_TEST(states, (std::vector<int>){1, 5, 41, 241, 1385, 6161, 28025, 107423, 1035, true},
+            "Function enumerateStates Test 2");
+    }
+
+    { // Function enumerateStates Test 3
+
+        EnumerationSettings settings;
+        settings.max_plies = 7;
+        settings.memory_budget = 0ULL;
+        settings.output_prefix = "state_enumeration_test_";
+        enumerateStates(settings);
+
+        // The ply 7 is a sorted position array, labeled with the won positions
+        PositionArray positions;
+        const auto opened{positions.open("state_enumeration_test_7.bin")};
+        const auto sorted{std::is_sorted(positions.begin(), positions.end(), comparePositions)};
+        uint64_t wins{0ULL};
+        for (const auto &position : positions) wins += position.label;
+
+        // The first player wins with four pieces in the column 4. With a piece in the column 3 instead, the position
+        // is kept in its own orientation, smaller than its mirror image with the piece in the column 5
+        Board game;
+        for (const auto column : std::string{"4040404"}) game.playMove(column - '0');
+        const auto won{positions.find(packPosition(game))};
+        const auto won_found{won != nullptr && won->label == 1};
+        game.undoLastMove();
+        game.playMove(3);
+        const auto canonical{positions.find(packPosition(game))};
+        const auto canonical_found{canonical != nullptr && canonical->label == 0};
+        const auto mirrored_found{positions.find(mirrorPosition(packPosition(game))) != nullptr};
+
+        const auto size{positions.getSize()};
+        positions.close();
+        for (int ply{0}; ply <= settings.max_plies; ply++) {
+            std::remove(("state_enumeration_test_" + std::to_string(ply) + ".bin").c_str());
+        }
+
+        EQ_TEST((std::vector<int>){opened, (int)size, sorted, (int)wins, won_found, canonical_found, mirrored_found},
+            (std::vector<int>){true, 107423, true, 1035, true, true, false}, "Function enumerateStates Test 3");
+    }
+
+}
@@ -0,0 +1,74 @@
+#include "testFunctions.hpp"
+#include "../runTests.hpp"
+#include "../src/tournament.hpp"
+#include <cmath>
+
+void runTournamentTests() {
+
+    std::cout << ansi::foreground_yellow << "TOURNAMENT TESTS" << ansi::reset << std::endl;
+
+    { // Function computeLLR Test 1
+
+        // Rounded to the third decimal
+        const auto rounded = [](const double &value) {return (int)std::lround(value * 1000.0);};
+
+        EQ_TEST((std::vector<int>){rounded(computeLLR(60, 20, 20, 0.0, 10.0)), rounded(computeLLR(20, 20, 60, 0.0, 10.0)),
+                rounded(computeLLR(10, 0, 0, 0.0, 10.0)), rounded(computeLLR(0, 0, 0, 0.0, 10.0))},
+            (std::vector<int>){1700, -1829, 1228, 0}, "Function computeLLR Test 1");
+    }
+
+    { // Function computeLLR Test 2
+
+        // A candidate that loses every game is rejected, and one that wins every game is accepted
+        EQ_TEST((std::vector<int>){decideSPRT(computeLLR(0, 0, 15, 0.0, 10.0), 0.05, 0.05),
+                decideSPRT(computeLLR(0, 0, 16, 0.0, 10.0), 0.05, 0.05),
+                decideSPRT(computeLLR(16, 0, 0, 0.0, 10.0), 0.05, 0.05)},
+            (std::vector<int>){TournamentResult::NONE, TournamentResult::H0, TournamentResult::H1},
+            "Function computeLLR Test 2");
+    }
+
+    { // Function decideSPRT Test
+
+        EQ_TEST((std::vector<int>){decideSPRT(3.0, 0.05, 0.05), decideSPRT(-3.0, 0.05, 0.05),
+                decideSPRT(2.9, 0.05, 0.05), decideSPRT(2.9, 0.1, 0.05)},
+            (std::vector<int>){TournamentResult::H1, TournamentResult::H0, TournamentResult::NONE, TournamentResult::H1},
+            "Function decideSPRT Test");
+    }
+
+    { // Function playGame Test
+
+        Engine first, second;
+        EngineSettings first_settings, second_settings;
+        first_settings.move_time_ms = 0;
+        second_settings.move_time_ms = 0;
+        SideStats first_stats, second_stats;
+
+        Engine *engines[2]{&first, &second};
+        const EngineSettings *settings[2]{&first_settings, &second_settings};
+        SideStats *stats[2]{&first_stats, &second_stats};
+
+        // The first player has three pieces in the column 4 and wins at once
+        const auto outcome{playGame(engines, settings, "404040", stats)};
+
+        EQ_TEST((std::vector<int>){outcome, (int)first_stats.moves, (int)second_stats.moves},
+            (std::vector<int>){1, 1, 0}, "Function playGame Test");
+    }
+
+    { // Function runTournament Test
+
+        TournamentSettings settings;
+        settings.first.move_time_ms = 0;
+        settings.second.move_time_ms = 0;
+        settings.first.table_size = (1U << 16) + 1U;
+        settings.second.table_size = (1U << 16) + 1U;
+        settings.games = 4;
+        settings.threads = 2;
+
+        auto calls{0};
+        const auto result{runTournament(settings, [&](const TournamentResult &) {calls++;})};
+
+        EQ_TEST((std::vector<int>){result.wins + result.draws + result.losses, calls, result.first_stats.moves > 0,
+                result.second_stats.moves > 0}, (std::vector<int>){4, 4, true, true}, "Function runTournament Test");
+    }
+
+};
@@ -0,0 +1,56 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "../src/solver.hpp"
+
+/**
+ * Solve every move of a position and print its exact score, its principal variation and its node count (multi-PV).
+ * Usage: analyzePosition.exe <moves> [table size]
+ * The moves are the played columns from the empty board, one digit per move ("-" for the empty board).
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 2 && argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <moves> [table size]" << std::endl;
+        return 1;
+    }
+
+    const std::string moves{argv[1] == std::string{"-"} ? "" : argv[1]};
+    const uint32_t table_size = argc == 3 ? std::stoul(argv[2]) : (1ULL << 23) - 15ULL;
+
+    // Replay the game, which must stop at its first line of four
+    Board board;
+    for (const auto move : moves) {
+        const auto column{move - '0'};
+        if (column < 0 || column >= 9 || !board.isValidPosition(column) || board.checkLastPlayerWin()) {
+            std::cerr << "Invalid moves: " << moves << std::endl;
+            return 1;
+        }
+        board.playMove(column);
+    }
+    if (board.checkLastPlayerWin() || board.checkFinishDraw()) {
+        std::cerr << "The game is over" << std::endl;
+        return 1;
+    }
+
+    Solver solver{table_size};
+    const auto start{std::chrono::steady_clock::now()};
+    const auto analysis{solver.analyze(board)};
+    const auto seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    auto best{Solver::MIN_SCORE - 1};
+    for (const auto &move : analysis) best = std::max(best, move.score);
+
+    std::cout << std::setw(6) << "column" << std::setw(7) << "score" << std::setw(14) << "nodes" << "  variation"
+        << std::endl;
+    for (const auto &move : analysis) {
+        std::cout << std::setw(6) << move.column << std::setw(7) << move.score << std::setw(14) << move.nodes << "  ";
+        for (const auto column : move.principal_variation) std::cout << column;
+        std::cout << (move.score == best ? " *" : "") << std::endl;
+    }
+
+    std::cout << "Nodes: " << solver.getNodeCount() << std::endl;
+    std::cout << "Time: " << seconds << " s (" << solver.getNodeCount() / seconds << " nodes/s)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/engine.hpp"
+
+/**
+ * Build an opening book for the engine.
+ * Usage: buildBook.exe <input file> <output file>
+ * Every line of the input is a position and the column to play from it: the played columns (one digit per move, "-"
+ * for the empty board), a space and the column. The positions are stored in their smallest orientation and sorted, so
+ * the engine finds them with a binary search in the mapped file. The first entry of a repeated position wins.
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input file> <output file>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream input{argv[1]};
+    if (!input.is_open()) {
+        std::cerr << "Unable to open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::vector<PackedPosition> entries;
+    std::string line;
+    auto line_number{0};
+    while (std::getline(input, line)) {
+        line_number++;
+        std::istringstream fields{line};
+        std::string moves;
+        int column;
+        if (!(fields >> moves >> column)) continue;
+
+        // Replay the position and check the move
+        Board board;
+        auto valid{true};
+        for (const auto move : moves) {
+            if (move == '-') continue;
+            if (move < '0' || move > '8' || !board.isValidPosition(move - '0') || board.checkLastPlayerWin()) {
+                valid = false;
+                break;
+            }
+            board.playMove(move - '0');
+        }
+        if (!valid || board.checkLastPlayerWin() || column < 0 || column > 8 || !board.isValidPosition(column)) {
+            std::cerr << "Skipping invalid line " << line_number << ": " << line << std::endl;
+            continue;
+        }
+
+        entries.push_back(Engine::makeBookEntry(board, column));
+    }
+
+    // Sort the positions and keep the first entry of each one
+    std::stable_sort(entries.begin(), entries.end(), comparePositions);
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const PackedPosition &lhs, const PackedPosition &rhs) {
+        return !comparePositions(lhs, rhs) && !comparePositions(rhs, lhs);
+    }), entries.end());
+
+    PositionArrayWriter writer;
+    if (!writer.open(argv[2])) {
+        std::cerr << "Unable to write " << argv[2] << std::endl;
+        return 1;
+    }
+    for (const auto &entry : entries) writer.add(entry);
+    if (!writer.close()) {
+        std::cerr << "Unable to write " << argv[2] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Positions: " << entries.size() << std::endl;
+    return 0;
+}
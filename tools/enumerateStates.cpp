@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "../src/stateEnumeration.hpp"
+
+/**
+ * Count the distinct positions reachable at every ply (a position and its mirror image counting once).
+ * Usage: enumerateStates.exe [option value]...
+ * Options: --plies (last ply), --threads, --memory (MiB of the hash sets before spilling to disk), --spill (directory
+ * of the temporary files) and --output (prefix of the position array written for every ply).
+ * Prints the positions, the won positions, the spilled runs and the rate of every ply, and the peak resident memory.
+ */
+int main(int argc, char *argv[]) {
+    EnumerationSettings settings;
+    settings.threads = std::max(1U, std::thread::hardware_concurrency());
+
+    for (int arg{1}; arg + 1 < argc; arg += 2) {
+        const std::string option{argv[arg]};
+        const std::string value{argv[arg + 1]};
+        if (option == "--plies") settings.max_plies = std::stoi(value);
+        else if (option == "--threads") settings.threads = std::stoi(value);
+        else if (option == "--memory") settings.memory_budget = std::stoull(value) << 20;
+        else if (option == "--spill") settings.spill_directory = value;
+        else if (option == "--output") settings.output_prefix = value;
+        else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Usage: " << argv[0] << " [option value]..." << std::endl;
+        return 1;
+    }
+
+    std::cout << std::setw(4) << "ply" << std::setw(14) << "states" << std::setw(12) << "wins" << std::setw(8) << "runs"
+        << std::setw(11) << "seconds" << std::setw(12) << "states/s" << std::endl;
+
+    std::vector<PlyStats> results;
+    try {
+        results = enumerateStates(settings, [](const PlyStats &stats) {
+            std::cout << std::setw(4) << stats.ply << std::setw(14) << stats.states << std::setw(12) << stats.wins
+                << std::setw(8) << stats.runs << std::fixed << std::setprecision(3) << std::setw(11) << stats.seconds
+                << std::setprecision(0) << std::setw(12) << stats.getStatesPerSecond() << std::defaultfloat << std::endl;
+        });
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    uint64_t states{0ULL};
+    auto seconds{0.0};
+    for (const auto &stats : results) {
+        states += stats.states;
+        seconds += stats.seconds;
+    }
+    std::cout << "States: " << states << " in " << std::fixed << std::setprecision(3) << seconds << " s ("
+        << std::setprecision(0) << (seconds > 0.0 ? states / seconds : 0.0) << " states/s)" << std::endl;
+    std::cout << "Peak memory: " << getPeakMemory() / (1 << 20) << " MiB" << std::endl;
+
+    return 0;
+}
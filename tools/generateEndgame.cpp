@@ -0,0 +1,52 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "../src/endgameDatabase.hpp"
+
+/**
+ * Offline generator of the endgame database.
+ * Usage: generateEndgame.exe <root moves> <max empty cells> <output file>
+ * The root moves are the played columns, one digit per move (use "-" for the empty board).
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <root moves> <max empty cells> <output file>" << std::endl;
+        return 1;
+    }
+
+    const std::string moves{argv[1]};
+    const auto max_empty{std::stoi(argv[2])};
+    const std::string path{argv[3]};
+
+    Board root;
+    for (const auto column : moves) {
+        if (column == '-') continue;
+        if (column < '0' || column > '8' || !root.isValidPosition(column - '0')) {
+            std::cerr << "Invalid root moves: " << moves << std::endl;
+            return 1;
+        }
+        root.playMove(column - '0');
+        if (root.checkLastPlayerWin()) {
+            std::cerr << "The root position is a finished game: " << moves << std::endl;
+            return 1;
+        }
+    }
+
+    EndgameDatabase database;
+    const auto start{std::chrono::steady_clock::now()};
+    database.generate(root, max_empty);
+    const auto end{std::chrono::steady_clock::now()};
+
+    if (!database.save(path)) {
+        std::cerr << "Unable to write " << path << std::endl;
+        return 1;
+    }
+
+    const auto positions{database.getPositionsNum()};
+    const auto bytes{database.getMemoryUsage()};
+    std::cout << "Positions: " << positions << std::endl;
+    std::cout << "Size: " << bytes << " bytes (" << (positions ? 8.0 * bytes / positions : 0.0) << " bits per position)" << std::endl;
+    std::cout << "Time: " << std::chrono::duration<double>(end - start).count() << " s" << std::endl;
+
+    return 0;
+}
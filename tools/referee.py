@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Local stand-in for the Codingame Connect 4 referee.
+
+Plays matches between two bot commands with the Codingame protocol: the ids of
+the players, then for every turn the turn index, the 7 rows of the grid (top
+row first), the valid actions and the previous action of the opponent (-1 for
+none, -2 for a steal). The second player may answer -2 on its first turn to
+steal the first piece. The first answer of a bot must come within 1000 ms and
+the others within 100 ms.
+
+Usage: python3 tools/referee.py <bot command> <bot command> [--games N] [--quiet]
+"""
+
+import argparse
+import selectors
+import shlex
+import subprocess
+import sys
+import time
+
+ROWS = 7
+COLS = 9
+STEAL = -2
+FIRST_TURN_LIMIT = 1.0
+TURN_LIMIT = 0.1
+
+
+class Bot:
+    """A bot process with line-based input and output."""
+
+    def __init__(self, command, quiet):
+        self.process = subprocess.Popen(
+            shlex.split(command), stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+            stderr=subprocess.DEVNULL if quiet else None, text=True, bufsize=1)
+        self.selector = selectors.DefaultSelector()
+        self.selector.register(self.process.stdout, selectors.EVENT_READ)
+        self.first_turn = True
+        self.max_time = {True: 0.0, False: 0.0}
+
+    def send(self, lines):
+        self.process.stdin.write("".join(str(line) + "\n" for line in lines))
+        self.process.stdin.flush()
+
+    def receive(self):
+        """Read the answer of a turn. Returns None on timeout or crash."""
+        limit = FIRST_TURN_LIMIT if self.first_turn else TURN_LIMIT
+        start = time.monotonic()
+        if not self.selector.select(timeout=limit):
+            return None
+        line = self.process.stdout.readline()
+        elapsed = time.monotonic() - start
+        self.max_time[self.first_turn] = max(self.max_time[self.first_turn], elapsed)
+        self.first_turn = False
+        return line.split()[0] if line.split() else None
+
+    def close(self):
+        self.process.kill()
+        self.process.wait()
+
+
+def has_four(grid, row, col):
+    """Check if the piece at (row, col) is part of a line of four."""
+    player = grid[row][col]
+    for dr, dc in ((0, 1), (1, 0), (1, 1), (1, -1)):
+        count = 1
+        for sign in (1, -1):
+            r, c = row + sign * dr, col + sign * dc
+            while 0 <= r < ROWS and 0 <= c < COLS and grid[r][c] == player:
+                count += 1
+                r, c = r + sign * dr, c + sign * dc
+        if count >= 4:
+            return True
+    return False
+
+
+def play_match(commands, quiet):
+    """Play one match. Returns the index of the winner (0 or 1), or None for a draw, and the bots."""
+    bots = [Bot(command, quiet) for command in commands]
+    for idx, bot in enumerate(bots):
+        bot.send([idx, 1 - idx])
+
+    grid = [["."] * COLS for _ in range(ROWS)]
+    previous = -1
+    first_column = None
+    winner = None
+    turn = 0
+    try:
+        while True:
+            player = turn % 2
+            actions = [col for col in range(COLS) if grid[0][col] == "."]
+            if not actions:
+                break
+            if turn == 1:
+                actions.append(STEAL)
+
+            bot = bots[player]
+            bot.send([turn] + ["".join(row) for row in grid] + [len(actions)] + actions + [previous])
+            answer = bot.receive()
+            try:
+                action = int(answer)
+            except (TypeError, ValueError):
+                action = None
+            if action not in actions:
+                print(f"Player {player} lost on turn {turn}: invalid or late answer {answer!r}", file=sys.stderr)
+                winner = 1 - player
+                break
+
+            if action == STEAL:
+                # The first piece changes hands
+                grid[ROWS - 1][first_column] = str(player)
+            else:
+                row = max(r for r in range(ROWS) if grid[r][action] == ".")
+                grid[row][action] = str(player)
+                if turn == 0:
+                    first_column = action
+                if has_four(grid, row, action):
+                    winner = player
+                    break
+
+            previous = action
+            turn += 1
+    finally:
+        for bot in bots:
+            bot.close()
+
+    return winner, bots
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local Connect 4 referee")
+    parser.add_argument("bots", nargs=2, help="commands of the two bots")
+    parser.add_argument("--games", type=int, default=2, help="number of matches (the bots swap seats)")
+    parser.add_argument("--quiet", action="store_true", help="hide the error output of the bots")
+    args = parser.parse_args()
+
+    results = [0, 0, 0]
+    max_time = [[0.0, 0.0], [0.0, 0.0]]
+    for game in range(args.games):
+        seats = [0, 1] if game % 2 == 0 else [1, 0]
+        winner, bots = play_match([args.bots[seat] for seat in seats], args.quiet)
+        results[2 if winner is None else seats[winner]] += 1
+        for seat, bot in zip(seats, bots):
+            max_time[seat][0] = max(max_time[seat][0], bot.max_time[True])
+            max_time[seat][1] = max(max_time[seat][1], bot.max_time[False])
+        print(f"Game {game + 1}: " + ("draw" if winner is None else f"bot {seats[winner]} wins"))
+
+    print(f"Bot 0 wins: {results[0]}, bot 1 wins: {results[1]}, draws: {results[2]}")
+    for seat in range(2):
+        print(f"Bot {seat} slowest answers: first turn {max_time[seat][0] * 1000:.1f} ms, "
+              f"other turns {max_time[seat][1] * 1000:.1f} ms")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,58 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/gameRecord.hpp"
+
+/**
+ * Replay and validate a game record file, one game per line.
+ * Usage: replayGames.exe <game record file> [threads]
+ * Prints the results of the games, how often every column is played and the replay rate.
+ */
+int main(int argc, char *argv[]) {
+    // Parse the thread count without exceptions, anything but a whole number in range shows the usage
+    auto threads_num{(int)std::max(1U, std::thread::hardware_concurrency())};
+    if (argc == 3) {
+        char *end{nullptr};
+        const auto value{std::strtol(argv[2], &end, 10)};
+        threads_num = end != argv[2] && *end == '\0' && value <= 1024 ? (int)value : 0;
+    }
+    if ((argc != 2 && argc != 3) || threads_num < 1) {
+        std::cerr << "Usage: " << argv[0] << " <game record file> [threads from 1 to 1024]" << std::endl;
+        return 1;
+    }
+
+    GameRecordReader reader;
+    if (!reader.open(argv[1])) {
+        std::cerr << "Unable to open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // Per-thread statistics, merged at the end
+    std::vector<std::vector<uint64_t>> column_counts(threads_num, std::vector<uint64_t>(9, 0ULL));
+    const auto stats{reader.replay(threads_num, [&](const int thread, const PositionRecord &record) {
+        column_counts[thread][record.column]++;
+    })};
+
+    std::cout << "Games: " << stats.games << " (" << stats.invalid_games << " invalid)" << std::endl;
+    std::cout << "First player wins: " << stats.first_player_wins << std::endl;
+    std::cout << "Second player wins: " << stats.second_player_wins << std::endl;
+    std::cout << "Draws: " << stats.draws << std::endl;
+    std::cout << "Unfinished: " << stats.unfinished_games << std::endl;
+    std::cout << "Positions: " << stats.positions << std::endl;
+
+    std::cout << "Moves per column:";
+    for (int column{0}; column < 9; column++) {
+        uint64_t count{0ULL};
+        for (const auto &counts : column_counts) count += counts[column];
+        std::cout << " " << count;
+    }
+    std::cout << std::endl;
+
+    std::cout << "Time: " << stats.seconds << " s with " << threads_num << " threads ("
+        << stats.games / stats.seconds << " games/s, " << stats.positions / stats.seconds << " positions/s)" << std::endl;
+
+    return 0;
+}
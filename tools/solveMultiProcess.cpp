@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "../src/multiProcessSolver.hpp"
+
+/**
+ * Solve a position with several worker processes that share a transposition table in shared memory.
+ * Usage: solveMultiProcess.exe <moves> [option value]...
+ * The moves are the played columns from the empty board, one digit per move ("-" for the empty board).
+ * Options: --workers, --depth (split depth of the root), --table (table size), --name (name of the shared memory
+ * segment) and --keep (1 to keep the table for the next runs, which start with its bounds).
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc % 2 != 0) {
+        std::cerr << "Usage: " << argv[0] << " <moves> [option value]..." << std::endl;
+        return 1;
+    }
+
+    MultiProcessSettings settings;
+    settings.workers = std::max(1U, std::thread::hardware_concurrency());
+    for (int arg{2}; arg + 1 < argc; arg += 2) {
+        const std::string option{argv[arg]};
+        const std::string value{argv[arg + 1]};
+        if (option == "--workers") settings.workers = std::stoi(value);
+        else if (option == "--depth") settings.split_depth = std::stoi(value);
+        else if (option == "--table") settings.table_size = std::stoul(value);
+        else if (option == "--name") settings.table_name = value;
+        else if (option == "--keep") settings.keep_table = value == "1";
+        else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+
+    // Replay the game, which must stop at its first line of four
+    const std::string moves{argv[1] == std::string{"-"} ? "" : argv[1]};
+    Board board;
+    for (const auto move : moves) {
+        const auto column{move - '0'};
+        if (column < 0 || column >= 9 || !board.isValidPosition(column) || board.checkLastPlayerWin()) {
+            std::cerr << "Invalid moves: " << moves << std::endl;
+            return 1;
+        }
+        board.playMove(column);
+    }
+    if (board.checkLastPlayerWin() || board.checkFinishDraw()) {
+        std::cerr << "The game is over" << std::endl;
+        return 1;
+    }
+
+    const auto start{std::chrono::steady_clock::now()};
+    const auto result{solveMultiProcess(board, settings)};
+    const auto seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    if (!result.solved) {
+        std::cerr << "Unsolved: " << result.crashes << " crashed workers" << std::endl;
+        return 1;
+    }
+    std::cout << "Score: " << result.score << std::endl;
+    std::cout << "Best move: " << result.best_move << std::endl;
+    std::cout << "Subtrees: " << result.subtrees << " (" << result.crashes << " crashed workers)" << std::endl;
+    std::cout << "Nodes: " << result.nodes << std::endl;
+    std::cout << "Time: " << seconds << " s (" << result.nodes / seconds << " nodes/s)" << std::endl;
+
+    return 0;
+}
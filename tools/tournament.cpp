@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "../src/tournament.hpp"
+
+/**
+ * @brief Print the statistics of an engine.
+ * @param settings The settings of the engine.
+ * @param stats The statistics of the engine.
+ */
+static void printStats(const EngineSettings &settings, const SideStats &stats) {
+    std::cout << std::setw(12) << settings.name << ": " << stats.moves << " moves, average depth " << std::fixed
+        << std::setprecision(1) << stats.getAverageDepth() << ", " << std::setprecision(0) << stats.getNodesPerSecond()
+        << " nodes/s" << std::defaultfloat << std::endl;
+}
+
+/**
+ * Self-play tournament between two settings of the engine, with SPRT early stopping.
+ * Usage: tournament.exe [option value]...
+ * Options: --games, --threads, --openings (random plies), --seed, --elo0, --elo1, --alpha, --beta and, for each engine
+ * (1 is the tested one, 2 the reference), --timeN (ms per move), --tableN (table size), --bookN (book file) and
+ * --proofN (node limit of the proof-number pre-check).
+ */
+int main(int argc, char *argv[]) {
+    TournamentSettings settings;
+    settings.first.name = "engine 1";
+    settings.second.name = "engine 2";
+    settings.threads = std::max(1U, std::thread::hardware_concurrency());
+
+    for (int arg{1}; arg + 1 < argc; arg += 2) {
+        const std::string option{argv[arg]};
+        const std::string value{argv[arg + 1]};
+        if (option == "--games") settings.games = std::stoi(value);
+        else if (option == "--threads") settings.threads = std::stoi(value);
+        else if (option == "--openings") settings.opening_plies = std::stoi(value);
+        else if (option == "--seed") settings.seed = std::stoull(value);
+        else if (option == "--elo0") settings.elo0 = std::stod(value);
+        else if (option == "--elo1") settings.elo1 = std::stod(value);
+        else if (option == "--alpha") settings.alpha = std::stod(value);
+        else if (option == "--beta") settings.beta = std::stod(value);
+        else if (option == "--time1") settings.first.move_time_ms = std::stoi(value);
+        else if (option == "--time2") settings.second.move_time_ms = std::stoi(value);
+        else if (option == "--table1") settings.first.table_size = std::stoul(value);
+        else if (option == "--table2") settings.second.table_size = std::stoul(value);
+        else if (option == "--book1") settings.first.book_path = value;
+        else if (option == "--book2") settings.second.book_path = value;
+        else if (option == "--proof1") settings.first.proof_nodes = std::stoull(value);
+        else if (option == "--proof2") settings.second.proof_nodes = std::stoull(value);
+        else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Usage: " << argv[0] << " [option value]..." << std::endl;
+        return 1;
+    }
+
+    std::cout << "Up to " << settings.games << " games on " << settings.threads << " threads, SPRT elo0 "
+        << settings.elo0 << " elo1 " << settings.elo1 << " (bounds " << std::log(settings.beta / (1.0 - settings.alpha))
+        << ", " << std::log((1.0 - settings.beta) / settings.alpha) << ")" << std::endl;
+
+    const auto result{runTournament(settings, [](const TournamentResult &current) {
+        const auto games{current.wins + current.draws + current.losses};
+        if (games % 10 == 0) {
+            std::cout << "Games " << games << ": +" << current.wins << " =" << current.draws << " -" << current.losses
+                << ", LLR " << current.llr << std::endl;
+        }
+    })};
+
+    const auto games{result.wins + result.draws + result.losses};
+    const auto score{games ? (result.wins + 0.5 * result.draws) / games : 0.5};
+    const auto elo{score > 0.0 && score < 1.0 ? -400.0 * std::log10(1.0 / score - 1.0) : 0.0};
+    std::cout << "Games: " << games << " in " << result.seconds << " s" << std::endl;
+    std::cout << "W/D/L: " << result.wins << "/" << result.draws << "/" << result.losses << " (score " << score
+        << ", " << elo << " Elo)" << std::endl;
+    std::cout << "SPRT: LLR " << result.llr << ", "
+        << (result.decision == TournamentResult::H1 ? "H1 accepted" :
+            result.decision == TournamentResult::H0 ? "H0 accepted" : "no decision") << std::endl;
+    printStats(settings.first, result.first_stats);
+    printStats(settings.second, result.second_stats);
+
+    return 0;
+}